@@ -27,7 +27,9 @@
  Definition of classes Chord, HelpLine and NoteList.
 */
 
+#include <array>
 #include <functional>
+#include <optional>
 #include <set>
 #include <vector>
 
@@ -51,6 +53,9 @@ class StemSlash;
 class TremoloTwoChord;
 class TremoloSingleChord;
 
+// style generation, duration, pitch lines, beam and staff type inputs of the default stem length, flattened
+using StemLengthInput = std::array<double, 21>;
+
 class GraceNotesGroup final : public std::vector<Chord*>, public EngravingItem
 {
     OBJECT_ALLOCATOR(engraving, GraceNotesGroup)
@@ -328,6 +333,13 @@ public:
 
     bool allNotesTiedToNext() const;
 
+    struct LayoutData : public ChordRest::LayoutData {
+        // kept across layouts, calculated again only when its input changes
+        std::optional<StemLengthInput> stemLengthInput;
+        double stemLength = 0.0;
+    };
+    DECLARE_LAYOUTDATA_METHODS(Chord)
+
 private:
 
     friend class Factory;
@@ -22,6 +22,8 @@
 
 #include "chordlist.h"
 
+#include <mutex>
+
 #include "global/io/file.h"
 #include "global/io/fileinfo.h"
 
@@ -1554,7 +1556,7 @@ const std::list<RenderActionPtr >& ParsedChord::renderList(const ChordList* cl)
         bool found = false;
         // potential definitions for token
         if (cl) {
-            for (const ChordToken& ct : cl->chordTokenList) {
+            for (const ChordToken& ct : cl->chordTokenList()) {
                 for (const String& ctn : ct.names) {
                     if (ctn == n) {
                         definedTokens.push_back(ct);
@@ -1784,6 +1786,45 @@ void ChordDescription::write(XmlWriter& xml) const
 
 int ChordList::privateID = -1000;
 
+static const std::shared_ptr<const ChordListTables>& emptyChordListTables()
+{
+    static const std::shared_ptr<const ChordListTables> tables = std::make_shared<const ChordListTables>();
+    return tables;
+}
+
+ChordList::ChordList()
+    : m_tables(emptyChordListTables())
+{
+}
+
+//---------------------------------------------------------
+//   mutTables
+//    tables to modify, copied first if they are shared
+//    with another list or the process wide cache
+//---------------------------------------------------------
+
+ChordListTables& ChordList::mutTables()
+{
+    if (m_tables.use_count() > 1) {
+        m_tables = std::make_shared<ChordListTables>(*m_tables);
+    }
+    m_sharedKey.clear();
+
+    // nobody else holds them now, and only the shared empty tables are created const,
+    // which are never modified in place as emptyChordListTables() keeps a reference
+    return const_cast<ChordListTables&>(*m_tables);
+}
+
+const ChordDescription& ChordList::insertDescription(const ChordDescription& cd)
+{
+    return mutTables().descriptions.insert({ cd.id, cd }).first->second;
+}
+
+void ChordList::clearDescriptions()
+{
+    mutTables().descriptions.clear();
+}
+
 //---------------------------------------------------------
 //   configureAutoAdjust
 //---------------------------------------------------------
@@ -1807,8 +1848,10 @@ void ChordList::configureAutoAdjust(double emag, double eadjust, double mmag, do
 
 void ChordList::read(XmlReader& e, int mscVersion)
 {
-    int fontIdx = static_cast<int>(fonts.size());
-    m_autoAdjust = false;
+    ChordListTables& tables = mutTables();
+
+    int fontIdx = static_cast<int>(tables.fonts.size());
+    tables.autoAdjust = false;
     while (e.readNextStartElement()) {
         const AsciiStringView tag(e.name());
         if (tag == "font") {
@@ -1853,7 +1896,7 @@ void ChordList::read(XmlReader& e, int mscVersion)
                         cs.value = cs.name;
                     }
                     cs.name = symClass + cs.name;
-                    m_symbols.insert({ cs.name, cs });
+                    tables.symbols.insert({ cs.name, cs });
                     e.readNext();
                 } else if (e.name() == "mag") {
                     f.mag = e.readDouble();
@@ -1861,36 +1904,36 @@ void ChordList::read(XmlReader& e, int mscVersion)
                     e.unknown();
                 }
             }
-            if (m_autoAdjust) {
+            if (tables.autoAdjust) {
                 if (f.fontClass == "extension") {
                     f.mag *= m_emag;
                 } else if (f.fontClass == "modifier") {
                     f.mag *= m_mmag;
                 }
             }
-            fonts.push_back(f);
+            tables.fonts.push_back(f);
             ++fontIdx;
         } else if (tag == "autoAdjust") {
             String nmag = e.attribute("mag");
             if (!nmag.empty()) {
-                m_nmag = nmag.toDouble();
+                tables.nmag = nmag.toDouble();
             }
             String nadjust = e.attribute("adjust");
             if (!nadjust.empty()) {
-                m_nadjust = nadjust.toDouble();
+                tables.nadjust = nadjust.toDouble();
             }
-            m_autoAdjust = e.readBool();
+            tables.autoAdjust = e.readBool();
         } else if (tag == "token") {
             ChordToken t;
             t.read(e, mscVersion);
-            chordTokenList.push_back(t);
+            tables.chordTokenList.push_back(t);
         } else if (tag == "chord") {
             int id = e.intAttribute("id");
             // if no id attribute (id == 0), then assign it a private id
             // user chords that match these ChordDescriptions will be treated as normal recognized chords
             // except that the id will not be written to the score file
-            ChordDescription cd = (id && muse::contains(*this, id))
-                                  ? muse::take(*this, id)
+            ChordDescription cd = (id && muse::contains(tables.descriptions, id))
+                                  ? muse::take(tables.descriptions, id)
                                   : ChordDescription(id);
 
             // record updated id
@@ -1904,15 +1947,15 @@ void ChordList::read(XmlReader& e, int mscVersion)
             // generate any missing info (including new parsed chords)
             cd.complete(0, this);
             // add to list
-            insert({ id, cd });
+            tables.descriptions.insert({ id, cd });
         } else if (tag == "renderRoot") {
-            readRenderList(e.readText(), renderListRoot, mscVersion);
+            readRenderList(e.readText(), tables.renderListRoot, mscVersion);
         } else if (tag == "renderFunction") {
-            readRenderList(e.readText(), renderListFunction, mscVersion);
+            readRenderList(e.readText(), tables.renderListFunction, mscVersion);
         } else if ((tag == "renderBase" && mscVersion < 460) || tag == "renderBass") {
-            readRenderList(e.readText(), renderListBass, mscVersion);
+            readRenderList(e.readText(), tables.renderListBass, mscVersion);
         } else if (tag == "renderBassOffset") {
-            readRenderList(e.readText(), renderListBassOffset, mscVersion);
+            readRenderList(e.readText(), tables.renderListBassOffset, mscVersion);
         } else {
             e.unknown();
         }
@@ -1926,10 +1969,10 @@ void ChordList::read(XmlReader& e, int mscVersion)
 void ChordList::write(XmlWriter& xml) const
 {
     int fontIdx = 0;
-    for (const ChordFont& f : fonts) {
+    for (const ChordFont& f : m_tables->fonts) {
         xml.startElement("font", { { "id", fontIdx }, { "family", f.family } });
         xml.tag("mag", f.mag);
-        for (const auto& p : m_symbols) {
+        for (const auto& p : m_tables->symbols) {
             const ChordSymbol& s = p.second;
             if (s.fontIdx == fontIdx) {
                 if (s.code.isNull()) {
@@ -1943,30 +1986,90 @@ void ChordList::write(XmlWriter& xml) const
         xml.endElement();
         ++fontIdx;
     }
-    if (m_autoAdjust) {
-        xml.tag("autoAdjust", { { "mag", m_nmag }, { "adjust", m_nadjust } });
+    if (m_tables->autoAdjust) {
+        xml.tag("autoAdjust", { { "mag", m_tables->nmag }, { "adjust", m_tables->nadjust } });
     }
-    for (const ChordToken& t : chordTokenList) {
+    for (const ChordToken& t : m_tables->chordTokenList) {
         t.write(xml);
     }
-    if (!renderListRoot.empty()) {
-        writeRenderList(xml, renderListRoot, "renderRoot");
+    if (!m_tables->renderListRoot.empty()) {
+        writeRenderList(xml, m_tables->renderListRoot, "renderRoot");
     }
-    if (!renderListFunction.empty()) {
-        writeRenderList(xml, renderListFunction, "renderFunction");
+    if (!m_tables->renderListFunction.empty()) {
+        writeRenderList(xml, m_tables->renderListFunction, "renderFunction");
     }
-    if (!renderListBass.empty()) {
-        writeRenderList(xml, renderListBass, "renderBass");
+    if (!m_tables->renderListBass.empty()) {
+        writeRenderList(xml, m_tables->renderListBass, "renderBass");
     }
-    if (!renderListBassOffset.empty()) {
-        writeRenderList(xml, renderListBassOffset, "renderBassOffset");
+    if (!m_tables->renderListBassOffset.empty()) {
+        writeRenderList(xml, m_tables->renderListBassOffset, "renderBassOffset");
     }
-    for (const auto& p : *this) {
+    for (const auto& p : m_tables->descriptions) {
         const ChordDescription& cd = p.second;
         cd.write(xml);
     }
 }
 
+//---------------------------------------------------------
+//   sharedChordLists
+//    chord tables parsed from description files, shared by all scores of the process
+//---------------------------------------------------------
+
+static constexpr size_t MAX_SHARED_CHORD_LISTS = 16;
+
+static std::mutex s_sharedChordListsMutex;
+
+static std::map<String, std::shared_ptr<const ChordListTables> >& sharedChordLists()
+{
+    static std::map<String, std::shared_ptr<const ChordListTables> > lists;
+    return lists;
+}
+
+//---------------------------------------------------------
+//   addSharedChordList
+//    drops the tables no list uses anymore once there are too many
+//---------------------------------------------------------
+
+static void addSharedChordList(const String& key, const std::shared_ptr<const ChordListTables>& tables)
+{
+    std::map<String, std::shared_ptr<const ChordListTables> >& lists = sharedChordLists();
+    if (lists.size() >= MAX_SHARED_CHORD_LISTS) {
+        for (auto it = lists.begin(); it != lists.end();) {
+            if (it->second.use_count() == 1) {
+                it = lists.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    lists[key] = tables;
+}
+
+//---------------------------------------------------------
+//   sharedListKey
+//    key of the current content, empty if it is not known
+//---------------------------------------------------------
+
+String ChordList::sharedListKey() const
+{
+    String settings = String(u"%1/%2/%3/%4/%5").arg(m_emag, m_eadjust, m_mmag).arg(m_madjust, m_stackedmmag)
+                      + String(u"/%1/%2/%3/%4").arg(m_tables->nmag, m_tables->nadjust).arg(int(m_stackModifiers), int(m_excludeModsHAlign))
+                      + u"/" + m_symbolTextFont;
+
+    const ChordListTables& t = *m_tables;
+    bool isEmpty = t.descriptions.empty() && t.fonts.empty() && t.symbols.empty() && t.chordTokenList.empty()
+                   && t.renderListRoot.empty() && t.renderListFunction.empty() && t.renderListBass.empty() && t.renderListBassOffset.empty();
+    if (isEmpty) {
+        return settings;
+    }
+
+    if (m_sharedKey.empty()) {
+        return String();
+    }
+
+    return m_sharedKey + u"|" + settings;
+}
+
 //---------------------------------------------------------
 //   read
 //    read Chord List, return false on error
@@ -1991,13 +2094,39 @@ bool ChordList::read(const muse::io::path_t& appDataPath, const String& name)
     if (name.isEmpty()) {
         return false;
     }
+    // the same description files are loaded by every score using a chord style,
+    // so they are only parsed once; a score modifying its list copies the tables first
+    String key = sharedListKey();
+    if (!key.empty()) {
+        key += u"|" + path.toString() + u"@" + FileInfo(path).lastModified().toString();
+
+        std::lock_guard<std::mutex> lock(s_sharedChordListsMutex);
+        auto it = sharedChordLists().find(key);
+        if (it != sharedChordLists().end()) {
+            m_tables = it->second;
+            m_sharedKey = key;
+            return true;
+        }
+    }
+
     File f(path);
     if (!f.open(IODevice::ReadOnly)) {
         LOGE() << "Cannot open chord description: " << f.filePath();
         return false;
     }
 
-    return read(&f);
+    if (!read(&f)) {
+        return false;
+    }
+
+    if (!key.empty()) {
+        m_sharedKey = key;
+
+        std::lock_guard<std::mutex> lock(s_sharedChordListsMutex);
+        addSharedChordList(key, m_tables);
+    }
+
+    return true;
 }
 
 bool ChordList::read(IODevice* device)
@@ -2065,7 +2194,7 @@ bool ChordList::loaded() const
     // since chords.xml really doesn't load enough to stand alone,
     // we need a way to track when a "real" chord list has been loaded
     // for lack of anything better, key off renderListRoot
-    return !renderListRoot.empty();
+    return !m_tables->renderListRoot.empty();
 }
 
 //---------------------------------------------------------
@@ -2074,19 +2203,20 @@ bool ChordList::loaded() const
 
 void ChordList::unload()
 {
-    clear();
-    m_symbols.clear();
-    fonts.clear();
-    renderListRoot.clear();
-    renderListBass.clear();
-    chordTokenList.clear();
-    m_autoAdjust = false;
+    // the function and bass offset render lists and the nominal adjustment are kept
+    std::shared_ptr<ChordListTables> tables = std::make_shared<ChordListTables>();
+    tables->renderListFunction = m_tables->renderListFunction;
+    tables->renderListBassOffset = m_tables->renderListBassOffset;
+    tables->nmag = m_tables->nmag;
+    tables->nadjust = m_tables->nadjust;
+    m_tables = tables;
+    m_sharedKey.clear();
 }
 
 const ChordDescription* ChordList::description(int id) const
 {
-    auto it = this->find(id);
-    if (it == this->end()) {
+    auto it = m_tables->descriptions.find(id);
+    if (it == m_tables->descriptions.end()) {
         return nullptr;
     }
     return &it->second;
@@ -2094,7 +2224,7 @@ const ChordDescription* ChordList::description(int id) const
 
 ChordToken ChordList::token(const String& s, ChordTokenClass type) const
 {
-    for (const ChordToken& tok : chordTokenList) {
+    for (const ChordToken& tok : m_tables->chordTokenList) {
         if (tok.tokenClass != type || !tok.names.contains(s)) {
             continue;
         }
@@ -24,6 +24,7 @@
 #define MU_ENGRAVING_CHORDLIST_H
 
 #include <map>
+#include <memory>
 
 #include "global/allocator.h"
 #include "global/types/string.h"
@@ -419,26 +420,53 @@ struct ChordFont {
 };
 
 //---------------------------------------------------------
-//   ChordList
-//    Reads chord XML files and stores the list of known chords
+//   ChordListTables
+//    the content read from chord description files
 //---------------------------------------------------------
 
-class ChordList : public std::map<int, ChordDescription>
-{
-    OBJECT_ALLOCATOR(engraving, ChordList)
-
-public:
+struct ChordListTables {
+    std::map<int, ChordDescription> descriptions;
+    std::map<String, ChordSymbol> symbols;
     std::list<ChordFont> fonts;
     std::list<RenderActionPtr > renderListRoot;
     std::list<RenderActionPtr > renderListFunction;
     std::list<RenderActionPtr > renderListBass;
     std::list<RenderActionPtr > renderListBassOffset;
     std::list<ChordToken> chordTokenList;
+    bool autoAdjust = false;
+    double nmag = 1.0, nadjust = 0.0;       // adjust values are measured in percentage
+};
+
+//---------------------------------------------------------
+//   ChordList
+//    Reads chord XML files and stores the list of known chords
+//    The tables are shared with the lists of other scores
+//    that read the same files, a list copies them when it is modified
+//---------------------------------------------------------
+
+class ChordList
+{
+    OBJECT_ALLOCATOR(engraving, ChordList)
+
+public:
+    ChordList();
+
     static int privateID;
 
-    bool autoAdjust() const { return m_autoAdjust; }
-    double nominalMag() const { return m_nmag; }
-    double nominalAdjust() const { return m_nadjust; }
+    const std::map<int, ChordDescription>& descriptions() const { return m_tables->descriptions; }
+    const ChordDescription& insertDescription(const ChordDescription& cd);
+    void clearDescriptions();
+
+    const std::list<ChordFont>& fonts() const { return m_tables->fonts; }
+    const std::list<RenderActionPtr>& renderListRoot() const { return m_tables->renderListRoot; }
+    const std::list<RenderActionPtr>& renderListFunction() const { return m_tables->renderListFunction; }
+    const std::list<RenderActionPtr>& renderListBass() const { return m_tables->renderListBass; }
+    const std::list<RenderActionPtr>& renderListBassOffset() const { return m_tables->renderListBassOffset; }
+    const std::list<ChordToken>& chordTokenList() const { return m_tables->chordTokenList; }
+
+    bool autoAdjust() const { return m_tables->autoAdjust; }
+    double nominalMag() const { return m_tables->nmag; }
+    double nominalAdjust() const { return m_tables->nadjust; }
     bool stackModifiers() const { return m_stackModifiers; }
     bool excludeModsHAlign() const { return m_excludeModsHAlign; }
     double stackedModifierMag() const { return m_stackedmmag; }
@@ -455,7 +483,7 @@ public:
     void unload();
 
     const ChordDescription* description(int id) const;
-    ChordSymbol symbol(const String& s) const { return muse::value(m_symbols, s); }
+    ChordSymbol symbol(const String& s) const { return muse::value(m_tables->symbols, s); }
     ChordToken token(const String& s, ChordTokenClass) const;
 
     void setCustomChordList(bool t) { m_customChordList = t; }
@@ -468,16 +496,22 @@ private:
     void read(XmlReader& xml, int mscVersion);
     void write(XmlWriter& xml) const;
 
-    std::map<String, ChordSymbol> m_symbols;
-    bool m_autoAdjust = false;
+    ChordListTables& mutTables();
+    String sharedListKey() const;
+
+    std::shared_ptr<const ChordListTables> m_tables;
+
     bool m_stackModifiers = false;
     bool m_excludeModsHAlign = false;
-    double m_nmag = 1.0, m_nadjust = 0.0;   // adjust values are measured in percentage
-    double m_emag = 1.0, m_eadjust = 0.0;   // (which is then applied to the height of the font)
-    double m_mmag = 1.0, m_madjust = 0.0, m_stackedmmag = 0.0;
+    double m_emag = 1.0, m_eadjust = 0.0;   // adjust values are measured in percentage
+    double m_mmag = 1.0, m_madjust = 0.0, m_stackedmmag = 0.0;   // (which is then applied to the height of the font)
     String m_symbolTextFont = u"";
 
     bool m_customChordList = false;         // if true, chordlist will be saved as part of score
+
+    // describes the description files loaded since the last unload() and the settings they were loaded with,
+    // empty if the tables were modified otherwise; parsed tables are shared between scores by this key
+    String m_sharedKey;
 };
 } // namespace mu::engraving
 #endif
@@ -366,12 +366,15 @@ void Score::undoRedo(bool undo, EditData* ed)
     UndoMacro::ChangesInfo changes;
 
     cmdState().reset();
-    if (undo) {
-        changes = changesInfo(undoStack(), undo);
-        undoStack()->undo(ed);
-    } else {
-        undoStack()->redo(ed);
-        changes = changesInfo(undoStack());
+    {
+        ScoreChangesBatch changesBatch(this);
+        if (undo) {
+            changes = changesInfo(undoStack(), undo);
+            undoStack()->undo(ed);
+        } else {
+            undoStack()->redo(ed);
+            changes = changesInfo(undoStack());
+        }
     }
 
     update(false);
@@ -2727,6 +2730,7 @@ void Score::cmdResetTextStyleOverrides()
 {
     TRACEFUNC;
 
+    ScoreChangesBatch changesBatch(this);
     scanElements(nullptr, resetTextProperties);
 }
 
@@ -2855,6 +2859,7 @@ void Score::resetAutoplace()
 {
     TRACEFUNC;
 
+    ScoreChangesBatch changesBatch(this);
     scanElements(nullptr, resetElementPosition);
 }
 
@@ -2862,7 +2867,7 @@ void Score::resetCrossBeams()
 {
     TRACEFUNC;
 
-    scanElements(nullptr, resetBeamOffSet);
+    scanElementsOfType(ElementType::BEAM, nullptr, resetBeamOffSet);
 }
 
 //---------------------------------------------------------
@@ -99,6 +99,8 @@ set(DOM_SRC
     ${CMAKE_CURRENT_LIST_DIR}/elementgroup.h
     ${CMAKE_CURRENT_LIST_DIR}/elementmap.cpp
     ${CMAKE_CURRENT_LIST_DIR}/elementmap.h
+    ${CMAKE_CURRENT_LIST_DIR}/elementtypeindex.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/elementtypeindex.h
     ${CMAKE_CURRENT_LIST_DIR}/engravingitem.cpp
     ${CMAKE_CURRENT_LIST_DIR}/engravingitem.h
     ${CMAKE_CURRENT_LIST_DIR}/engravingobject.cpp
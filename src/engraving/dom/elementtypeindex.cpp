@@ -0,0 +1,265 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "elementtypeindex.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "beam.h"
+#include "chord.h"
+#include "measure.h"
+#include "page.h"
+#include "score.h"
+#include "segment.h"
+#include "spanner.h"
+#include "system.h"
+
+using namespace mu;
+
+namespace mu::engraving {
+namespace {
+//! Position of an item in the order Score::scanElements() visits it:
+//! measure, its mm-rest, segment, position within the segment
+using ScanOrder = std::tuple<int, bool, int, unsigned, size_t>;
+
+class Liveness
+{
+public:
+    //! Whether the segment is part of the score, rather than removed (e.g. kept for undo)
+    bool isLive(const Segment* segment)
+    {
+        const Measure* measure = segment->measure();
+        if (!measure || !segment->enabled()) {
+            return false;
+        }
+
+        bool linked = segment->prev() ? segment->prev()->next() == segment : measure->first() == segment;
+        return linked && isLive(measure);
+    }
+
+    bool isLive(const Measure* measure)
+    {
+        auto it = m_measures.find(measure);
+        if (it != m_measures.end()) {
+            return it->second;
+        }
+
+        bool live = false;
+        if (measure->isMMRest()) {
+            const Measure* first = measure->mmRestFirst();
+            live = first && first->mmRest() == measure && isLive(first);
+        } else {
+            live = measure->score()->tick2measure(measure->tick()) == measure;
+        }
+
+        m_measures.emplace(measure, live);
+        return live;
+    }
+
+    bool isLive(const ChordRest* cr)
+    {
+        if (cr->isGrace()) {
+            const EngravingObject* parent = cr->explicitParent();
+            if (!parent || !parent->isChord()) {
+                return false;
+            }
+
+            const Chord* chord = toChord(parent);
+            const std::vector<Chord*>& graceNotes = chord->graceNotes();
+            return std::find(graceNotes.begin(), graceNotes.end(), cr) != graceNotes.end() && isLive(chord);
+        }
+
+        const Segment* segment = cr->segment();
+        return segment && segment->element(cr->track()) == cr && isLive(segment);
+    }
+
+private:
+    std::unordered_map<const Measure*, bool> m_measures;
+};
+
+ScanOrder scanOrder(const Segment* segment, size_t index)
+{
+    const Measure* measure = segment->measure();
+    const Measure* scanned = measure->isMMRest() ? measure->mmRestFirst() : measure;
+    return { scanned->tick().ticks(), measure->isMMRest(), segment->tick().ticks(),
+             static_cast<unsigned>(segment->segmentType()), index };
+}
+}
+
+//---------------------------------------------------------
+//   isRegisteredType
+//    annotations of segments and beams, whose items are
+//    tracked through their construction and destruction
+//---------------------------------------------------------
+
+bool ElementTypeIndex::isRegisteredType(ElementType type)
+{
+    switch (type) {
+    case ElementType::DYNAMIC:
+    case ElementType::EXPRESSION:
+    case ElementType::STAFF_TEXT:
+    case ElementType::SYSTEM_TEXT:
+    case ElementType::TEMPO_TEXT:
+    case ElementType::REHEARSAL_MARK:
+    case ElementType::INSTRUMENT_CHANGE:
+    case ElementType::STICKING:
+    case ElementType::BEAM:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------
+//   isSystemSpannerSegmentType
+//    spanner segments are taken from the systems directly
+//---------------------------------------------------------
+
+bool ElementTypeIndex::isSystemSpannerSegmentType(ElementType type)
+{
+    switch (type) {
+    case ElementType::SLUR_SEGMENT:
+    case ElementType::HAIRPIN_SEGMENT:
+    case ElementType::OTTAVA_SEGMENT:
+    case ElementType::TRILL_SEGMENT:
+    case ElementType::LET_RING_SEGMENT:
+    case ElementType::VIBRATO_SEGMENT:
+    case ElementType::PALM_MUTE_SEGMENT:
+    case ElementType::TEXTLINE_SEGMENT:
+    case ElementType::VOLTA_SEGMENT:
+    case ElementType::PEDAL_SEGMENT:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+bool ElementTypeIndex::isIndexed(ElementType type)
+{
+    return isRegisteredType(type) || isSystemSpannerSegmentType(type);
+}
+
+void ElementTypeIndex::add(EngravingObject* object)
+{
+    if (isRegisteredType(object->type())) {
+        m_objects[object->type()].insert(object);
+    }
+}
+
+void ElementTypeIndex::remove(EngravingObject* object)
+{
+    if (!isRegisteredType(object->type())) {
+        return;
+    }
+
+    auto it = m_objects.find(object->type());
+    if (it != m_objects.end()) {
+        it->second.erase(object);
+    }
+}
+
+//---------------------------------------------------------
+//   items
+//    registered objects also include removed items kept
+//    by the undo stack, so only those still reachable
+//    from the score are returned
+//---------------------------------------------------------
+
+std::vector<EngravingItem*> ElementTypeIndex::items(const Score* score, ElementType type) const
+{
+    std::vector<EngravingItem*> result;
+
+    if (isSystemSpannerSegmentType(type)) {
+        for (const Page* page : score->pages()) {
+            for (const System* system : page->systems()) {
+                if (system->vbox()) {
+                    continue;
+                }
+                for (SpannerSegment* ss : system->spannerSegments()) {
+                    if (ss->type() == type) {
+                        result.push_back(ss);
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    auto it = m_objects.find(type);
+    if (it == m_objects.end()) {
+        return result;
+    }
+
+    Liveness liveness;
+    std::vector<std::pair<ScanOrder, EngravingItem*> > found;
+
+    for (EngravingObject* object : it->second) {
+        EngravingItem* item = static_cast<EngravingItem*>(object);
+
+        if (item->isBeam()) {
+            const Beam* beam = toBeam(item);
+            if (beam->elements().empty()) {
+                continue;
+            }
+
+            // scanned with the first chord of the beam
+            const ChordRest* cr = beam->elements().front();
+            if (cr->beam() != beam || !liveness.isLive(cr)) {
+                continue;
+            }
+
+            found.emplace_back(scanOrder(cr->segment(), cr->track()), item);
+            continue;
+        }
+
+        const EngravingObject* parent = item->explicitParent();
+        if (!parent || !parent->isSegment()) {
+            continue;
+        }
+
+        const Segment* segment = toSegment(parent);
+        const std::vector<EngravingItem*>& annotations = segment->annotations();
+        auto pos = std::find(annotations.begin(), annotations.end(), item);
+        if (pos == annotations.end() || !liveness.isLive(segment)) {
+            continue;
+        }
+
+        found.emplace_back(scanOrder(segment, static_cast<size_t>(pos - annotations.begin())), item);
+    }
+
+    std::sort(found.begin(), found.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    result.reserve(found.size());
+    for (const auto& pair : found) {
+        result.push_back(pair.second);
+    }
+
+    return result;
+}
+} // namespace mu::engraving
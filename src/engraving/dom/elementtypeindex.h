@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_ELEMENTTYPEINDEX_H
+#define MU_ENGRAVING_ELEMENTTYPEINDEX_H
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../types/types.h"
+
+namespace mu::engraving {
+class EngravingItem;
+class EngravingObject;
+class Score;
+
+//---------------------------------------------------------
+//   ElementTypeIndex
+//    Items of some element types kept per score, so that
+//    commands working on all items of one type don't have
+//    to walk the whole element tree
+//---------------------------------------------------------
+
+class ElementTypeIndex
+{
+public:
+    static bool isIndexed(ElementType type);
+
+    void add(EngravingObject* object);
+    void remove(EngravingObject* object);
+
+    //! The items of the type Score::scanElements() visits, in score order
+    std::vector<EngravingItem*> items(const Score* score, ElementType type) const;
+
+private:
+    static bool isRegisteredType(ElementType type);
+    static bool isSystemSpannerSegmentType(ElementType type);
+
+    std::unordered_map<ElementType, std::unordered_set<EngravingObject*> > m_objects;
+};
+}
+
+#endif // MU_ENGRAVING_ELEMENTTYPEINDEX_H
@@ -204,7 +204,13 @@ void EngravingItem::notifyAboutNameChanged()
 
     if (m_accessible) {
         doInitAccessible();
-        m_accessible->accessibleRoot()->notifyAboutFocusedElementNameChanged();
+        AccessibleRoot* root = m_accessible->accessibleRoot();
+        MasterScore* ms = masterScore();
+        if (ms && ms->isChangesBatchOpen()) {
+            ms->notifyAboutFocusedElementNameChangedLater(root);
+        } else {
+            root->notifyAboutFocusedElementNameChanged();
+        }
     }
 }
 
@@ -30,6 +30,7 @@
 #include "types/typesconv.h"
 
 #include "bracketItem.h"
+#include "elementtypeindex.h"
 #include "linkedobjects.h"
 #include "masterscore.h"
 #include "score.h"
@@ -92,6 +93,10 @@ EngravingObject::EngravingObject(const EngravingObject& se)
     }
     m_links = 0;
 
+    if (m_score && m_score->elementTypeIndex()) {
+        m_score->elementTypeIndex()->add(this);
+    }
+
     // reg to debug
     if (m_type != ElementType::SCORE) {
         if (m_score && m_score->elementsProvider()) {
@@ -135,6 +140,10 @@ EngravingObject::~EngravingObject()
         score()->elementsProvider()->unreg(this);
     }
 
+    if (score() && score()->elementTypeIndex()) {
+        score()->elementTypeIndex()->remove(this);
+    }
+
     if (m_links) {
         m_links->remove(this);
         if (m_links->empty()) {
@@ -172,8 +181,16 @@ void EngravingObject::doSetScore(Score* sc)
         return;
     }
 
+    if (m_score && m_score->elementTypeIndex()) {
+        m_score->elementTypeIndex()->remove(this);
+    }
+
     m_score = sc;
 
+    if (m_score && m_score->elementTypeIndex()) {
+        m_score->elementTypeIndex()->add(this);
+    }
+
     for (EngravingObject* ch : m_children) {
         ch->doSetScore(sc);
     }
@@ -83,7 +83,7 @@ const ChordDescription* HarmonyInfo::descr(const String& name, const ParsedChord
     if (!chordList()) {
         return nullptr;
     }
-    for (const auto& p : *chordList()) {
+    for (const auto& p : chordList()->descriptions()) {
         const ChordDescription& cd = p.second;
         for (const String& s : cd.names) {
             if (s == name) {
@@ -154,8 +154,7 @@ const ChordDescription* HarmonyInfo::generateDescription()
     // remove parsed chord from description
     // so we will only match it literally in the future
     cd.parsedChords.clear();
-    chordList()->insert({ cd.id, cd });
-    return &chordList()->at(cd.id);
+    return &chordList()->insertDescription(cd);
 }
 
 ParsedChord* HarmonyInfo::getParsedChord()
@@ -207,7 +206,7 @@ String Harmony::harmonyName() const
             // try to find the chord in chordList
             const ChordDescription* newExtension = nullptr;
             const ChordList* cl = score()->chordList();
-            for (const auto& p : *cl) {
+            for (const auto& p : cl->descriptions()) {
                 const ChordDescription& cd = p.second;
                 if (cd.chord == hc && !cd.names.empty()) {
                     newExtension = &cd;
@@ -1449,7 +1448,7 @@ void Harmony::renderSingleHarmony(HarmonyInfo* info, HarmonyRenderCtx& ctx)
 
     int capo = style().styleI(Sid::capoPosition);
 
-    ChordList* chordList = info->chordList();
+    const ChordList* chordList = info->chordList();
     if (!chordList) {
         return;
     }
@@ -1465,7 +1464,7 @@ void Harmony::renderSingleHarmony(HarmonyInfo* info, HarmonyRenderCtx& ctx)
 
     if (m_harmonyType == HarmonyType::STANDARD && tpcIsValid(info->rootTpc())) {
         // render root
-        render(chordList->renderListRoot, ctx, info->rootTpc(), spelling, rootCase);
+        render(chordList->renderListRoot(), ctx, info->rootTpc(), spelling, rootCase);
         // render extension
         const ChordDescription* cd = info->getDescription();
         if (cd) {
@@ -1473,7 +1472,7 @@ void Harmony::renderSingleHarmony(HarmonyInfo* info, HarmonyRenderCtx& ctx)
         }
     } else if (m_harmonyType == HarmonyType::NASHVILLE && tpcIsValid(info->rootTpc())) {
         // render function
-        render(chordList->renderListFunction, ctx, info->rootTpc(), spelling, bassCase);
+        render(chordList->renderListFunction(), ctx, info->rootTpc(), spelling, bassCase);
         double adjust = chordList->nominalAdjust();
         ctx.movey(adjust * magS() * spatium() * .2);
         // render extension
@@ -1487,8 +1486,8 @@ void Harmony::renderSingleHarmony(HarmonyInfo* info, HarmonyRenderCtx& ctx)
 
     // render bass
     if (tpcIsValid(info->bassTpc())) {
-        std::list<RenderActionPtr >& bassNoteChordList
-            = style().styleB(Sid::chordBassNoteStagger) ? chordList->renderListBassOffset : chordList->renderListBass;
+        const std::list<RenderActionPtr >& bassNoteChordList
+            = style().styleB(Sid::chordBassNoteStagger) ? chordList->renderListBassOffset() : chordList->renderListBass();
         render(bassNoteChordList, ctx, info->bassTpc(), spelling, bassCase, m_bassScale);
     }
 
@@ -1518,7 +1517,7 @@ void Harmony::renderSingleHarmony(HarmonyInfo* info, HarmonyRenderCtx& ctx)
         }
 
         render(SymId::csymParensLeftTall, ctx);
-        render(chordList->renderListRoot, ctx, capoRootTpc, spelling, rootCase);
+        render(chordList->renderListRoot(), ctx, capoRootTpc, spelling, rootCase);
 
         // render extension
         const ChordDescription* cd = info->getDescription();
@@ -1527,8 +1526,8 @@ void Harmony::renderSingleHarmony(HarmonyInfo* info, HarmonyRenderCtx& ctx)
         }
 
         if (tpcIsValid(capoBassTpc)) {
-            std::list<RenderActionPtr >& bassNoteChordList
-                = style().styleB(Sid::chordBassNoteStagger) ? chordList->renderListBassOffset : chordList->renderListBass;
+            const std::list<RenderActionPtr >& bassNoteChordList
+                = style().styleB(Sid::chordBassNoteStagger) ? chordList->renderListBassOffset() : chordList->renderListBass();
             render(bassNoteChordList, ctx, capoBassTpc, spelling, bassCase, m_bassScale);
         }
         render(SymId::csymParensRightTall, ctx);
@@ -1557,10 +1556,10 @@ void Harmony::render()
 
     // Render standard or Nashville chords
 
-    ChordList* chordList = score()->chordList();
+    const ChordList* chordList = score()->chordList();
 
     m_fontList.clear();
-    for (const ChordFont& cf : chordList->fonts) {
+    for (const ChordFont& cf : chordList->fonts()) {
         Font ff(font());
         double mag = m_userMag.value_or(cf.mag);
         ff.setPointSizeF(ff.pointSizeF() * mag);
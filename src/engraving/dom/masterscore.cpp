@@ -31,6 +31,10 @@
 
 #include "style/defaultstyle.h"
 
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+#include "accessibility/accessibleroot.h"
+#endif
+
 #include "engravingproject.h"
 
 #include "barline.h"
@@ -158,6 +162,71 @@ void MasterScore::setPlaylistDirty()
     m_nonExpandedRepeatList->setScoreChanged();
 }
 
+//---------------------------------------------------------
+//   beginChangesBatch
+//---------------------------------------------------------
+
+void MasterScore::beginChangesBatch()
+{
+    ++m_changesBatchDepth;
+}
+
+//---------------------------------------------------------
+//   endChangesBatch
+//    runs the side effects deferred by the batch once
+//---------------------------------------------------------
+
+void MasterScore::endChangesBatch()
+{
+    IF_ASSERT_FAILED(m_changesBatchDepth > 0) {
+        return;
+    }
+
+    if (--m_changesBatchDepth > 0) {
+        return;
+    }
+
+    for (Score* score : scoreList()) {
+        if (score->m_needUpdateSwing) {
+            score->updateSwing();
+        }
+        if (score->m_needUpdateCapo) {
+            score->updateCapo();
+        }
+    }
+
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+    std::set<AccessibleRoot*> roots;
+    roots.swap(m_nameChangedAccessibleRoots);
+    for (AccessibleRoot* root : roots) {
+        root->notifyAboutFocusedElementNameChanged();
+    }
+#endif
+}
+
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+void MasterScore::notifyAboutFocusedElementNameChangedLater(AccessibleRoot* root)
+{
+    m_nameChangedAccessibleRoots.insert(root);
+}
+
+#endif
+
+//---------------------------------------------------------
+//   ScoreChangesBatch
+//---------------------------------------------------------
+
+ScoreChangesBatch::ScoreChangesBatch(Score* score)
+    : m_masterScore(score->masterScore())
+{
+    m_masterScore->beginChangesBatch();
+}
+
+ScoreChangesBatch::~ScoreChangesBatch()
+{
+    m_masterScore->endChangesBatch();
+}
+
 //---------------------------------------------------------
 //   setExpandRepeats
 //---------------------------------------------------------
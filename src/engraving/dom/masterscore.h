@@ -23,6 +23,7 @@
 #define MU_ENGRAVING_MASTERSCORE_H
 
 #include <array>
+#include <set>
 
 #include "../infrastructure/ifileinfoprovider.h"
 #include "../infrastructure/eidregister.h"
@@ -31,6 +32,9 @@
 #include "score.h"
 
 namespace mu::engraving {
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+class AccessibleRoot;
+#endif
 class EngravingProject;
 class MscReader;
 class MscWriter;
@@ -136,6 +140,16 @@ public:
     bool excerptsChanged() const { return m_cmdState.excerptsChanged; }
     bool instrumentsChanged() const { return m_cmdState.instrumentsChanged; }
 
+    //! NOTE While a changes batch is open, side effects of single changes
+    //! (swing/capo caches, accessibility notifications) are deferred
+    //! and run once when the outermost batch ends, see ScoreChangesBatch
+    void beginChangesBatch();
+    void endChangesBatch();
+    bool isChangesBatchOpen() const { return m_changesBatchDepth > 0; }
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+    void notifyAboutFocusedElementNameChangedLater(AccessibleRoot* root);
+#endif
+
     void setTempomap(TempoMap* tm);
 
     int midiPortCount() const { return m_midiPortCount; }
@@ -232,6 +246,11 @@ private:
 
     CmdState m_cmdState;       // modified during cmd processing
 
+    int m_changesBatchDepth = 0;
+#ifndef ENGRAVING_NO_ACCESSIBILITY
+    std::set<AccessibleRoot*> m_nameChangedAccessibleRoots;
+#endif
+
     std::array<Fraction, 2> m_loopBoundaries; ///< 0 - LoopIn, 1 - LoopOut
 
     int m_midiPortCount = 0;                           // A count of ALSA midi out ports
@@ -27,6 +27,8 @@
 
 #include "measure.h"
 
+#include <algorithm>
+
 #include "accidental.h"
 #include "actionicon.h"
 #include "anchors.h"
@@ -2570,6 +2572,7 @@ Measure* Measure::cloneMeasure(Score* sc, const Fraction& tick, TieMap* tieMap)
 
     size_t tracks = sc->nstaves() * VOICES;
     TupletMap tupletMap;
+    std::vector<EngravingItem*> annotations;
 
     for (Segment* oseg = first(); oseg; oseg = oseg->next()) {
         Segment* s = Factory::createSegment(m, oseg->segmentType(), oseg->rtick());
@@ -2578,13 +2581,24 @@ Measure* Measure::cloneMeasure(Score* sc, const Fraction& tick, TieMap* tieMap)
         s->setHeader(oseg->header());
         s->setTrailer(oseg->trailer());
 
+        // annotations ordered by track (keeping their order within a track),
+        // so that each track below only visits its own ones
+        annotations.clear();
+        for (EngravingItem* e : oseg->annotations()) {
+            if (!e->generated()) {
+                annotations.push_back(e);
+            }
+        }
+        std::stable_sort(annotations.begin(), annotations.end(), [](const EngravingItem* a, const EngravingItem* b) {
+            return a->track() < b->track();
+        });
+        auto annotation = annotations.cbegin();
+
         m->m_segments.push_back(s);
         for (track_idx_t track = 0; track < tracks; ++track) {
             EngravingItem* oe = oseg->element(track);
-            for (EngravingItem* e : oseg->annotations()) {
-                if (e->generated() || e->track() != track) {
-                    continue;
-                }
+            for (; annotation != annotations.cend() && (*annotation)->track() == track; ++annotation) {
+                EngravingItem* e = *annotation;
                 EngravingItem* ne = e->clone();
                 ne->setTrack(track);
                 ne->setOffset(e->offset());
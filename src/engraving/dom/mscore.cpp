@@ -44,6 +44,7 @@ bool MScore::noHorizontalStretch = false;
 bool MScore::noVerticalStretch   = false;
 bool MScore::useFallbackFont     = true;
 // #endif
+bool MScore::noLayoutCaches = false;
 
 bool MScore::saveTemplateMode = false;
 bool MScore::noGui = false;
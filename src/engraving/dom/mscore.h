@@ -223,6 +223,7 @@ public:
     static bool noVerticalStretch;
     static bool useFallbackFont;
 // #endif
+    static bool noLayoutCaches;     // don't reuse layout results of identical input, to check that they don't change the layout
     static bool debugMode;
     static bool testMode;
     static bool testWriteStyleToScore;
@@ -74,6 +74,44 @@ std::vector<EngravingItem*> Page::items(const PointF& point)
     return bspTree.items(point);
 }
 
+//---------------------------------------------------------
+//   hitShapeContains
+//---------------------------------------------------------
+
+bool Page::hitShapeContains(const EngravingItem* item, const PointF& p)
+{
+    const Shape& shape = pageHitShape(item);
+    return shape.bbox().contains(p) && shape.contains(p);
+}
+
+//---------------------------------------------------------
+//   hitShapeIntersects
+//---------------------------------------------------------
+
+bool Page::hitShapeIntersects(const EngravingItem* item, const RectF& r)
+{
+    const Shape& shape = pageHitShape(item);
+    return shape.bbox().intersects(r) && shape.intersects(r);
+}
+
+//---------------------------------------------------------
+//   pageHitShape
+//---------------------------------------------------------
+
+const Shape& Page::pageHitShape(const EngravingItem* item)
+{
+    if (!m_bspTreeValid) {
+        doRebuildBspTree();
+    }
+
+    auto it = m_hitShapes.find(item);
+    if (it == m_hitShapes.end()) {
+        it = m_hitShapes.emplace(item, item->hitShape().translated(item->pagePos())).first;
+    }
+
+    return it->second;
+}
+
 //---------------------------------------------------------
 //   appendSystem
 //---------------------------------------------------------
@@ -339,6 +377,8 @@ void Page::doRebuildBspTree()
 
     bspTree.initialize(r, n);
     scanElements(&bspTree, &bspInsert, false);
+    m_hitShapes.clear();
+    ++m_bspTreeRevision;
     m_bspTreeValid = true;
 }
 
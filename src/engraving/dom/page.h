@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_PAGE_H
 #define MU_ENGRAVING_PAGE_H
 
+#include <unordered_map>
 #include <vector>
 
 #include "engravingitem.h"
@@ -77,6 +78,11 @@ public:
     std::vector<EngravingItem*> items(const RectF& r);
     std::vector<EngravingItem*> items(const PointF& p);
     void invalidateBspTree() { m_bspTreeValid = false; }
+    bool isBspTreeValid() const { return m_bspTreeValid; }
+    size_t bspTreeRevision() const { return m_bspTreeRevision; }
+
+    bool hitShapeContains(const EngravingItem* item, const PointF& p);      ///< p in page coordinates
+    bool hitShapeIntersects(const EngravingItem* item, const RectF& r);     ///< r in page coordinates
     PointF pagePos() const override { return PointF(); }       ///< position in page coordinates
     std::vector<EngravingItem*> elements() const;              ///< list of visible elements
     RectF tbbox() const;                             // tight bounding box, excluding white space
@@ -94,6 +100,7 @@ private:
     Page(RootItem* parent);
 
     void doRebuildBspTree();
+    const Shape& pageHitShape(const EngravingItem* item);
     TextBlock replaceTextMacros(const TextBlock&) const;
     const CharFormat formatForMacro(const String&) const;
 
@@ -102,6 +109,10 @@ private:
 
     BspTree bspTree;
     bool m_bspTreeValid = false;
+    size_t m_bspTreeRevision = 0;
+
+    // hit shapes of the items in page coordinates, computed on demand and valid as long as the bsp tree is
+    std::unordered_map<const EngravingItem*, Shape> m_hitShapes;
 };
 } // namespace mu::engraving
 #endif
@@ -435,6 +435,7 @@ std::vector<EngravingItem*> Score::cmdPaste(const IMimeData* ms, MuseScoreView*
         return {};
     }
 
+    ScoreChangesBatch changesBatch(this);
     std::vector<EngravingItem*> droppedElements;
 
     if (ms->hasFormat(mimeSymbolFormat)) {
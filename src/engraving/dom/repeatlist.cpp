@@ -173,6 +173,19 @@ void RepeatList::update(bool expand, bool updateTies)
         return;
     }
 
+    // Most edits (pitches, dynamics, text...) leave the playback order untouched:
+    // keep the previous segments and only refresh their timing. Tie jump points
+    // can only become stale when the structure changes, so skip those as well
+    RepeatStructure structure = collectRepeatStructure();
+    if (expand == m_expanded && !empty() && structure == m_structure) {
+        if (m_expanded) {
+            updateTempo();
+        }
+        m_scoreChanged = false;
+        return;
+    }
+    m_structure = std::move(structure);
+
     if (expand) {
         unwind();
     } else {
@@ -186,6 +199,72 @@ void RepeatList::update(bool expand, bool updateTies)
     }
 }
 
+//---------------------------------------------------------
+//   collectRepeatStructure
+//    cheap single pass over the score, compared against
+//    the previous one to decide whether to unwind again
+//---------------------------------------------------------
+
+RepeatList::RepeatStructure RepeatList::collectRepeatStructure() const
+{
+    RepeatStructure structure;
+    std::vector<intptr_t>& items = structure.items;
+
+    for (const MeasureBase* mb = m_score->firstMeasure(); mb; mb = mb->next()) {
+        items.push_back(reinterpret_cast<intptr_t>(mb));
+        items.push_back(mb->tick().ticks());
+        items.push_back(mb->ticks().ticks());
+        items.push_back(mb->repeatStart());
+        items.push_back(mb->repeatEnd());
+        items.push_back(mb->isMeasure() ? toMeasure(mb)->repeatCount() : 0);
+
+        const LayoutBreak* sectionBreak = mb->sectionBreakElement();
+        items.push_back(mb->sectionBreak());
+        if (sectionBreak) {
+            structure.pauses.push_back(sectionBreak->pause());
+        }
+
+        for (const EngravingItem* e : mb->el()) {
+            if (e->systemFlag() && !e->isTopSystemObject()) {
+                continue;
+            }
+
+            if (e->isJump()) {
+                const Jump* jump = toJump(e);
+                items.push_back(reinterpret_cast<intptr_t>(jump));
+                items.push_back(jump->playRepeats());
+                structure.labels.push_back(jump->jumpTo());
+                structure.labels.push_back(jump->playUntil());
+                structure.labels.push_back(jump->continueAt());
+            } else if (e->isMarker()) {
+                const Marker* marker = toMarker(e);
+                items.push_back(reinterpret_cast<intptr_t>(marker));
+                items.push_back(static_cast<intptr_t>(marker->align().horizontal));
+                structure.labels.push_back(marker->label());
+            }
+        }
+    }
+
+    for (const auto& spannerEntry : m_score->spanner()) {
+        const Spanner* spanner = spannerEntry.second;
+        if (!spanner->isVolta() || !spanner->playSpanner()) {
+            continue;
+        }
+
+        const Volta* volta = toVolta(spanner);
+        items.push_back(reinterpret_cast<intptr_t>(volta));
+        items.push_back(reinterpret_cast<intptr_t>(volta->startMeasure()));
+        items.push_back(reinterpret_cast<intptr_t>(volta->endMeasure()));
+        items.push_back(static_cast<intptr_t>(volta->getProperty(Pid::END_HOOK_TYPE).value<HookType>()));
+        items.push_back(static_cast<intptr_t>(volta->endings().size()));
+        for (int ending : volta->endings()) {
+            items.push_back(ending);
+        }
+    }
+
+    return structure;
+}
+
 //---------------------------------------------------------
 //   updateTempo
 //---------------------------------------------------------
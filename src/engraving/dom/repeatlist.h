@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_REPEATLIST_H
 #define MU_ENGRAVING_REPEATLIST_H
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -112,6 +113,21 @@ private:
     void unwind();
     void flatten();
 
+    //! Everything in the score the unwinding depends on: measures with their ticks and
+    //! repeat barlines, section breaks, jumps, markers and voltas
+    struct RepeatStructure {
+        std::vector<intptr_t> items;
+        std::vector<double> pauses;
+        std::vector<muse::String> labels;
+
+        bool operator==(const RepeatStructure& other) const
+        {
+            return items == other.items && pauses == other.pauses && labels == other.labels;
+        }
+    };
+
+    RepeatStructure collectRepeatStructure() const;
+
     Score* m_score = nullptr;
     mutable unsigned m_idx1, m_idx2 = 0;     // cached values
 
@@ -120,6 +136,7 @@ private:
 
     std::set<std::pair<Jump const* const, int> > m_jumpsTaken;     // take the jumps only once, so track them during unwind
     std::vector<RepeatListElementList> m_rlElements;               // all elements of the score that influence the RepeatList
+    RepeatStructure m_structure;                                   // structure the current segments were built from
 };
 } // namespace mu::engraving
 #endif
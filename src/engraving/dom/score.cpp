@@ -29,6 +29,7 @@
 
 #include <cmath>
 #include <map>
+#include <unordered_set>
 
 #include "containers.h"
 
@@ -49,6 +50,7 @@
 #include "capo.h"
 #include "chord.h"
 #include "clef.h"
+#include "elementtypeindex.h"
 #include "excerpt.h"
 #include "dynamic.h"
 #include "factory.h"
@@ -158,6 +160,7 @@ Score::Score(const modularity::ContextPtr& iocCtx)
 
     Score::validScores.insert(this);
     m_masterScore = nullptr;
+    m_elementTypeIndex = new ElementTypeIndex();
 
     m_engravingFont = engravingFonts()->fontByName("Leland");
 
@@ -275,6 +278,9 @@ Score::~Score()
 
     delete m_rootItem;
     m_rootItem = nullptr;
+
+    delete m_elementTypeIndex;
+    m_elementTypeIndex = nullptr;
 }
 
 muse::async::Channel<LoopBoundaryType, unsigned> Score::loopBoundaryTickChanged() const
@@ -403,32 +409,117 @@ void Score::setUpTempoMapLater()
       - inserting or removing a measure
       - changing the sigmap
       - after inserting/deleting time (changes the sigmap)
+
+ If `from` is given, only the maps from the measure before it onward are rebuilt;
+ all measures before `from` must be unchanged. Otherwise the whole score is.
 */
 
-void Score::setUpTempoMap()
+void Score::setUpTempoMap(MeasureBase* from)
 {
     TRACEFUNC;
 
-    Fraction tick = Fraction(0, 1);
+    // the measure before the first changed one is rebuilt too:
+    // it looks ahead for the anacrusis tempo and its pauses end at the changed one
+    Measure* start = nullptr;
+    if (from) {
+        MeasureBase* mb = from;
+        while (mb && !mb->isMeasure()) {
+            mb = mb->next();
+        }
+        start = mb ? toMeasure(mb)->prevMeasure() : lastMeasure();
+    }
+
+    // a pending full rebuild can't be replaced with a partial one
+    if (!start || start == firstMeasure() || m_needSetUpTempoMap) {
+        doSetUpTempoMap(nullptr);
+        m_needSetUpTempoMap = false;
+        return;
+    }
+
+    doSetUpTempoMap(start);
+
+#ifndef NDEBUG
+    if (isMaster()) {
+        const std::map<int, TEvent> tempoEvents = *tempomap();
+        const std::map<int, SigEvent> sigEvents = *sigmap();
+        doSetUpTempoMap(nullptr);
+        if (tempoEvents != *tempomap() || sigEvents != *sigmap()) {
+            LOGE() << "tempo map rebuilt from measure " << start->no() << " differs from the full rebuild";
+            assert(false);
+        }
+    }
+#endif
+
+    m_needSetUpTempoMap = false;
+}
+
+//---------------------------------------------------------
+//   findTempoPrimo
+//    first tempo of the score before the given measure,
+//    as it is found by rebuildTempoAndTimeSigMaps
+//---------------------------------------------------------
+
+static std::optional<BeatsPerSecond> findTempoPrimo(const Score* score, const Measure* end)
+{
+    for (const Segment* s = score->firstSegment(SegmentType::ChordRest | SegmentType::TimeTick); s && s->measure() != end;
+         s = s->next1(SegmentType::ChordRest | SegmentType::TimeTick)) {
+        for (const EngravingItem* e : s->annotations()) {
+            if (!e->isTempoText()) {
+                continue;
+            }
+            const TempoText* tt = toTempoText(e);
+            if (tt->playTempoText() && tt->isNormal() && !tt->isRelative()) {
+                return tt->tempo();
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+//---------------------------------------------------------
+//   doSetUpTempoMap
+//    rebuilds the maps from the start measure onward,
+//    or for the whole score if there is none
+//---------------------------------------------------------
+
+void Score::doSetUpTempoMap(Measure* start)
+{
     Measure* fm = firstMeasure();
     if (!fm) {
         return;
     }
 
+    const Fraction startTick = start ? start->tick() : Fraction(0, 1);
+    Fraction tick = startTick;
+
     for (Staff* staff : m_staves) {
-        staff->clearTimeSig();
+        if (start) {
+            staff->clearTimeSig(startTick);
+        } else {
+            staff->clearTimeSig();
+        }
     }
 
+    // the points of gradual tempo changes are set after the measures are processed,
+    // so the kept ones must not be seen by "a tempo" and fermatas from the start on
+    std::map<int, TEvent> keptRamps;
+
     if (isMaster()) {
-        tempomap()->clear();
-        sigmap()->clear();
-        sigmap()->add(0, SigEvent(fm->ticks(),  fm->timesig(), 0));
+        if (start) {
+            tempomap()->clearRange(startTick.ticks(), std::numeric_limits<int>::max());
+            sigmap()->clearRange(startTick.ticks(), std::numeric_limits<int>::max());
+            keptRamps = tempomap()->takeRamps(0, startTick.ticks());
+        } else {
+            tempomap()->clear();
+            sigmap()->clear();
+            sigmap()->add(0, SigEvent(fm->ticks(),  fm->timesig(), 0));
+        }
     }
     std::vector<Measure*> anacrusisMeasures;
 
-    auto tempoPrimo = std::optional<BeatsPerSecond> {};
+    auto tempoPrimo = (start && isMaster()) ? findTempoPrimo(this, start) : std::optional<BeatsPerSecond> {};
 
-    for (MeasureBase* mb = first(); mb; mb = mb->next()) {
+    for (MeasureBase* mb = start ? static_cast<MeasureBase*>(start) : first(); mb; mb = mb->next()) {
         if (mb->type() != ElementType::MEASURE) {
             mb->setTick(tick);
             continue;
@@ -453,6 +544,8 @@ void Score::setUpTempoMap()
     m_measures.updateTickIndex();
 
     if (isMaster()) {
+        tempomap()->restoreRamps(keptRamps);
+
         for (const auto& pair : spanner()) {
             const Spanner* spannerItem = pair.second;
             if (!spannerItem || !spannerItem->isGradualTempoChange() || !spannerItem->playSpanner()) {
@@ -464,6 +557,11 @@ void Score::setUpTempoMap()
                 continue;
             }
 
+            // the points of earlier changes are kept with the rest of the maps before the start
+            if (start && tempoChange->tick2() < startTick) {
+                continue;
+            }
+
             int tickPositionFrom = tempoChange->tick().ticks();
             BeatsPerSecond currentBps = tempomap()->tempo(tickPositionFrom);
             BeatsPerSecond newBps = currentBps * tempoChange->tempoChangeFactor();
@@ -479,7 +577,7 @@ void Score::setUpTempoMap()
                 int tick2 = tickPositionFrom + pair2.first;
 
                 if (tempomap()->find(tick2) == tempomap()->end()) {
-                    tempomap()->setTempo(tick2, BeatsPerSecond(currentBps.val + pair2.second));
+                    tempomap()->setTempo(tick2, BeatsPerSecond(currentBps.val + pair2.second), TempoType::RAMP);
                 }
             }
         }
@@ -493,7 +591,6 @@ void Score::setUpTempoMap()
     if (!anacrusisMeasures.empty()) {
         fixAnacrusisTempo(anacrusisMeasures);
     }
-    m_needSetUpTempoMap = false;
 }
 
 //---------------------------------------------------------
@@ -2298,7 +2395,7 @@ bool Score::appendMeasuresFromScore(Score* score, const Fraction& startTick, con
     }
 
     // clone the spanners (only in the range currently copied)
-    auto ospans = score->spanner();
+    const auto& ospans = score->spanner();
     auto lb = ospans.lower_bound(startTick.ticks()), ub = ospans.upper_bound(endTick.ticks());
     for (auto sp = lb; sp != ub; sp++) {
         Spanner* spanner = sp->second;
@@ -3030,48 +3127,72 @@ void Score::cmdConcertPitchChanged(bool flag)
 
     undoChangeStyleVal(Sid::concertPitch, flag);         // change style flag
 
-    for (Staff* staff : m_staves) {
-        if (staff->staffType(Fraction(0, 1))->group() == StaffGroup::PERCUSSION) {         // TODO
-            continue;
-        }
-        // if this staff has no transposition, and no instrument changes, we can skip it
-        Interval interval = staff->part()->instrument()->transpose(); //tick?
-        if (interval.isZero() && staff->part()->instruments().size() == 1) {
+    std::vector<bool> transposeStaff(m_staves.size(), false);
+    bool hasTransposition = false;
+
+    for (Part* part : m_parts) {
+        // if this part has no transposition, and no instrument changes, we can skip it
+        Interval interval = part->instrument()->transpose(); //tick?
+        if (interval.isZero() && part->instruments().size() == 1) {
             continue;
         }
-        if (!flag) {
-            interval.flip();
+
+        // the key signatures of all staves of the part in one walk over the key signature segments
+        transposeKeys(part->startTrack() / VOICES, part->endTrack() / VOICES, Fraction(0, 1), lastSegment()->tick(), !flag);
+
+        for (Staff* staff : part->staves()) {
+            if (staff->staffType(Fraction(0, 1))->group() == StaffGroup::PERCUSSION) {         // TODO
+                continue;
+            }
+            transposeStaff[staff->idx()] = true;
+            hasTransposition = true;
         }
+    }
 
-        staff_idx_t staffIdx   = staff->idx();
-        track_idx_t startTrack = staffIdx * VOICES;
-        track_idx_t endTrack   = startTrack + VOICES;
+    if (!hasTransposition) {
+        return;
+    }
 
-        transposeKeys(staffIdx, staffIdx + 1, Fraction(0, 1), lastSegment()->tick(), !flag);
+    // one pass over the score for the chord symbols of all transposed staves,
+    // they are transposed with one undo command per staff
+    std::vector<std::vector<std::pair<Harmony*, Interval> > > staffHarmonies(m_staves.size());
 
-        for (Segment* segment = firstSegment(SegmentType::ChordRest); segment; segment = segment->next1(SegmentType::ChordRest)) {
-            interval = staff->transpose(segment->tick());
+    for (Segment* segment = firstSegment(SegmentType::ChordRest); segment; segment = segment->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : segment->annotations()) {
+            if (!e->isHarmony()) {
+                continue;
+            }
+            staff_idx_t staffIdx = e->staffIdx();
+            if (staffIdx >= transposeStaff.size() || !transposeStaff[staffIdx]) {
+                continue;
+            }
+            Interval interval = e->staff()->transpose(segment->tick());
             if (!flag) {
                 interval.flip();
             }
-            for (EngravingItem* e : segment->annotations()) {
-                if (!e->isHarmony() || (e->track() < startTrack) || (e->track() >= endTrack)) {
-                    continue;
-                }
-                Harmony* h  = toHarmony(e);
-                for (EngravingObject* se : h->linkList()) {
-                    // don't transpose all links
-                    // just ones resulting from mmrests
-                    Harmony* he = toHarmony(se);              // toHarmony() does not work as e is an ScoreElement
-                    if (he->staff() == h->staff()) {
-                        undoTransposeHarmony(he, interval);
-                    }
+            Harmony* h  = toHarmony(e);
+            for (EngravingObject* se : h->linkList()) {
+                // don't transpose all links
+                // just ones resulting from mmrests
+                Harmony* he = toHarmony(se);              // toHarmony() does not work as e is an ScoreElement
+                if (he->staff() == h->staff()) {
+                    staffHarmonies[staffIdx].emplace_back(he, interval);
                 }
-                //realized harmony should be invalid after a transpose command
-                assert(!h->realizedHarmony().valid());
             }
         }
     }
+
+    for (const std::vector<std::pair<Harmony*, Interval> >& harmonies : staffHarmonies) {
+        if (harmonies.empty()) {
+            continue;
+        }
+        undo(new TransposeHarmonies(harmonies, true));
+
+        //realized harmony should be invalid after a transpose command
+        for (const auto& pair : harmonies) {
+            assert(!pair.first->realizedHarmony().valid());
+        }
+    }
 }
 
 void Score::padToggle(Pad p, bool toggleForSelectionOnly)
@@ -3453,8 +3574,13 @@ void Score::select(EngravingItem* item, SelectType type, staff_idx_t staffIdx)
 
 void Score::select(const std::vector<EngravingItem*>& items, SelectType type, staff_idx_t staffIdx)
 {
-    for (EngravingItem* item : items) {
-        doSelect(item, type, staffIdx);
+    if (type == SelectType::ADD && items.size() > 1) {
+        selectAdd(items);
+        setSelectionChanged(true);
+    } else {
+        for (EngravingItem* item : items) {
+            doSelect(item, type, staffIdx);
+        }
     }
 
     if (!m_selection.elements().empty()) {
@@ -3566,6 +3692,47 @@ void Score::selectAdd(EngravingItem* e)
     m_selection.setState(selState);
 }
 
+//---------------------------------------------------------
+//   selectAdd
+//    same as adding the items one by one, but list items are
+//    added in batches that update the selection only once
+//---------------------------------------------------------
+
+void Score::selectAdd(const std::vector<EngravingItem*>& items)
+{
+    std::unordered_set<EngravingItem*> selected(m_selection.elements().begin(), m_selection.elements().end());
+    std::vector<EngravingItem*> batch;
+
+    auto addBatch = [this, &batch]() {
+        if (batch.empty()) {
+            return;
+        }
+        for (EngravingItem* e : batch) {
+            addRefresh(e->pageBoundingRect());
+        }
+        m_selection.add(batch);
+        m_selection.setState(SelState::LIST);
+        batch.clear();
+    };
+
+    for (EngravingItem* e : items) {
+        if (!m_selection.isRange() && !e->isMeasure()) {
+            if (selected.insert(e).second) {
+                batch.push_back(e);
+            }
+            continue;
+        }
+
+        // these may change the selection state, so keep the order of the items
+        addBatch();
+        selectAdd(e);
+        selected.clear();
+        selected.insert(m_selection.elements().begin(), m_selection.elements().end());
+    }
+
+    addBatch();
+}
+
 //---------------------------------------------------------
 //   selectRange
 //    staffIdx is valid, if element is of type MEASURE
@@ -3979,7 +4146,7 @@ void Score::selectSimilar(EngravingItem* e, bool sameStaff)
     pattern.staffEnd = sameStaff ? e->staffIdx() + 1 : muse::nidx;
     pattern.voice = muse::nidx;
 
-    score->scanElements(&pattern, collectMatch);
+    score->scanElementsOfType(type, &pattern, collectMatch);
 
     score->select(0, SelectType::SINGLE, 0);
     score->select(pattern.el, SelectType::ADD, 0);
@@ -5887,6 +6054,36 @@ void Score::scanElements(void* data, void (* func)(void*, EngravingItem*), bool
     }
 }
 
+//---------------------------------------------------------
+//   scanElementsOfType
+///   Same as scanElements() for the items of one type only.
+///   Indexed types don't need to walk the whole score.
+//---------------------------------------------------------
+
+void Score::scanElementsOfType(ElementType type, void* data, void (* func)(void*, EngravingItem*))
+{
+    if (m_elementTypeIndex && ElementTypeIndex::isIndexed(type)) {
+        for (EngravingItem* item : m_elementTypeIndex->items(this, type)) {
+            func(data, item);
+        }
+        return;
+    }
+
+    struct TypeFilter {
+        ElementType type;
+        void* data;
+        void (* func)(void*, EngravingItem*);
+    };
+
+    TypeFilter filter { type, data, func };
+    scanElements(&filter, [](void* filterData, EngravingItem* item) {
+        TypeFilter* f = static_cast<TypeFilter*>(filterData);
+        if (item->type() == f->type) {
+            f->func(f->data, item);
+        }
+    });
+}
+
 //---------------------------------------------------------
 //   connectTies
 ///   Rebuild tie connections.
@@ -6096,6 +6293,13 @@ void Score::removeSystemLock(const SystemLock* lock)
 
 void Score::updateSwing()
 {
+    // rescans the whole score, a changes batch does it once when it ends
+    if (masterScore()->isChangesBatchOpen()) {
+        m_needUpdateSwing = true;
+        return;
+    }
+    m_needUpdateSwing = false;
+
     for (Staff* s : m_staves) {
         s->clearSwingList();
     }
@@ -6136,6 +6340,12 @@ void Score::updateSwing()
 
 void Score::updateCapo()
 {
+    if (masterScore()->isChangesBatchOpen()) {
+        m_needUpdateCapo = true;
+        return;
+    }
+    m_needUpdateCapo = false;
+
     for (Staff* s : m_staves) {
         s->clearCapoParams();
     }
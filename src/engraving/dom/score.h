@@ -104,6 +104,7 @@ class ChordRest;
 class Clef;
 class Dynamic;
 class Element;
+class ElementTypeIndex;
 class EventsHolder;
 class Excerpt;
 class FiguredBass;
@@ -321,9 +322,12 @@ public:
     EngravingObject* scanParent() const override;
     EngravingObjectList scanChildren() const override;
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
+    void scanElementsOfType(ElementType type, void* data, void (* func)(void*, EngravingItem*));
 
     void dumpScoreTree();  // for debugging purposes
 
+    ElementTypeIndex* elementTypeIndex() const { return m_elementTypeIndex; }
+
     RootItem* rootItem() const { return m_rootItem; }
     compat::DummyElement* dummy() const { return m_rootItem->dummy(); }
 
@@ -668,7 +672,7 @@ public:
     Segment* tick2leftSegmentMM(const Fraction& tick) { return tick2leftSegment(tick, /* useMMRest */ true); }
 
     void setUpTempoMapLater();
-    void setUpTempoMap();
+    void setUpTempoMap(MeasureBase* from = nullptr);
 
     EngravingItem* nextElement();
     EngravingItem* prevElement();
@@ -1107,6 +1111,7 @@ private:
     void doSelect(EngravingItem* e, SelectType type, staff_idx_t staffIdx);
     void selectSingle(EngravingItem* e, staff_idx_t staffIdx);
     void selectAdd(EngravingItem* e);
+    void selectAdd(const std::vector<EngravingItem*>& items);
     void selectRange(EngravingItem* e, staff_idx_t staffIdx);
 
     bool canReselectItem(const EngravingItem* item) const;
@@ -1121,6 +1126,7 @@ private:
     void resetTempoRange(const Fraction& tick1, const Fraction& tick2);
     void rebuildTempoAndTimeSigMaps(Measure* m, std::optional<BeatsPerSecond>& tempoPrimo);
     void fixAnacrusisTempo(const std::vector<Measure*>& measures) const;
+    void doSetUpTempoMap(Measure* start);
 
     void doUndoRemoveStaleTieJumpPoints(Tie* tie, bool undo = true);
     void doUndoResetPartialSlur(Slur* slur, bool undo);
@@ -1208,6 +1214,8 @@ private:
 
     bool m_isOpen = false;
     bool m_needSetUpTempoMap = true;
+    bool m_needUpdateSwing = false;         // deferred by an open changes batch
+    bool m_needUpdateCapo = false;
 
     std::map<String, String> m_metaTags;
 
@@ -1217,6 +1225,7 @@ private:
     PlayMode m_playMode = PlayMode::SYNTHESIZER;
 
     RootItem* m_rootItem = nullptr;
+    ElementTypeIndex* m_elementTypeIndex = nullptr;
     LayoutOptions m_layoutOptions;
 
     muse::async::Channel<EngravingItem*> m_elementDestroyed;
@@ -1259,5 +1268,20 @@ public:
     static bool loading() { return m_loading > 0; }
 };
 
+//---------------------------------------------------------
+//   ScoreChangesBatch
+//    keeps a changes batch of the master score open
+//    while it exists
+//---------------------------------------------------------
+
+class ScoreChangesBatch
+{
+    MasterScore* m_masterScore = nullptr;
+
+public:
+    ScoreChangesBatch(Score* score);
+    ~ScoreChangesBatch();
+};
+
 DECLARE_OPERATORS_FOR_FLAGS(LayoutFlags)
 } // namespace mu::engraving
@@ -25,6 +25,8 @@
  Implementation of class Selection plus other selection related functions.
 */
 
+#include <algorithm>
+
 #include "global/containers.h"
 #include "global/io/buffer.h"
 
@@ -427,6 +429,22 @@ void Selection::add(EngravingItem* el)
     update();
 }
 
+//---------------------------------------------------------
+//   add
+//    appends all items and updates the selection once;
+//    the caller is responsible for not passing items that are already selected
+//---------------------------------------------------------
+
+void Selection::add(const std::vector<EngravingItem*>& items)
+{
+    IF_ASSERT_FAILED(!isLocked()) {
+        LOGE() << "selection locked, reason: " << lockReason();
+        return;
+    }
+    m_el.insert(m_el.end(), items.begin(), items.end());
+    update();
+}
+
 void Selection::appendFiltered(EngravingItem* e)
 {
     IF_ASSERT_FAILED(!isLocked()) {
@@ -438,7 +456,7 @@ void Selection::appendFiltered(EngravingItem* e)
     }
 }
 
-void Selection::appendChordRest(ChordRest* cr)
+void Selection::appendChordRest(ChordRest* cr, std::unordered_set<const Beam*>& appendedBeams)
 {
     IF_ASSERT_FAILED(!isLocked()) {
         LOGE() << "selection locked, reason: " << lockReason();
@@ -463,20 +481,20 @@ void Selection::appendChordRest(ChordRest* cr)
     Chord* chord = toChord(cr);
     for (Chord* graceNote : chord->graceNotes()) {
         if (canSelect(graceNote)) {
-            appendChord(graceNote);
+            appendChord(graceNote, appendedBeams);
         }
     }
 
-    appendChord(chord);
+    appendChord(chord, appendedBeams);
 }
 
-void Selection::appendChord(Chord* chord)
+void Selection::appendChord(Chord* chord, std::unordered_set<const Beam*>& appendedBeams)
 {
     IF_ASSERT_FAILED(!isLocked()) {
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    if (chord->beam() && !muse::contains(m_el, static_cast<EngravingItem*>(chord->beam()))) {
+    if (chord->beam() && appendedBeams.insert(chord->beam()).second) {
         m_el.push_back(chord->beam());
     }
     if (chord->stem()) {
@@ -552,35 +570,38 @@ void Selection::appendChord(Chord* chord)
     }
 }
 
-void Selection::appendTupletHierarchy(Tuplet* innermostTuplet)
+//! NOTE: `appended` mirrors m_el, because the selected flag isn't set until Selection::update...
+void Selection::appendTupletHierarchy(Tuplet* innermostTuplet, std::unordered_set<const EngravingItem*>& appended)
 {
-    if (muse::contains(m_el, static_cast<EngravingItem*>(innermostTuplet))) {
+    if (muse::contains(appended, static_cast<const EngravingItem*>(innermostTuplet))) {
         return;
     }
 
-    //! NOTE: It's not very efficient to use muse::contains here. It would be nicer to simply use
-    //! de->selected() instead, but the selected flag isn't set until Selection::update...
     const std::vector<DurationElement*> elements = innermostTuplet->elements();
     for (DurationElement* de : elements) {
         if (!de->isChord()) {
-            if (!muse::contains(m_el, static_cast<EngravingItem*>(de))) {
+            if (!muse::contains(appended, static_cast<const EngravingItem*>(de))) {
                 return;
             }
             continue;
         }
         for (Note* note : toChord(de)->notes()) {
-            if (!muse::contains(m_el, static_cast<EngravingItem*>(note))) {
+            if (!muse::contains(appended, static_cast<const EngravingItem*>(note))) {
                 return;
             }
         }
     }
 
+    size_t count = m_el.size();
     appendFiltered(innermostTuplet);
+    if (m_el.size() > count) {
+        appended.insert(innermostTuplet);
+    }
 
     // Recursively append upwards/outwards
     Tuplet* outerTuplet = innermostTuplet->tuplet();
     if (outerTuplet) {
-        appendTupletHierarchy(outerTuplet);
+        appendTupletHierarchy(outerTuplet, appended);
     }
 }
 
@@ -670,30 +691,40 @@ void Selection::updateSelectedElements()
     //! if all of their contained elements are selected...
     std::unordered_set<Tuplet*> innerTuplets;
 
-    for (track_idx_t st = startTrack; st < endTrack; ++st) {
-        if (!canSelectVoice(st)) {
+    //! NOTE: Elements are appended track by track, but the segments are traversed only once:
+    //! the candidates of each track are collected in segment order first
+    std::vector<std::vector<EngravingItem*> > trackElements(endTrack - startTrack);
+    for (Segment* s = m_startSegment; s && (s != m_endSegment); s = s->next1MM()) {
+        if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
             continue;
         }
-        for (Segment* s = m_startSegment; s && (s != m_endSegment); s = s->next1MM()) {
-            if (!s->enabled() || s->isEndBarLineType()) {      // do not select end bar line
-                continue;
-            }
-            for (EngravingItem* e : s->annotations()) {
-                if (e->track() != st) {
-                    continue;
-                }
-                if (e->isFretDiagram()) {
-                    FretDiagram* fd = toFretDiagram(e);
-                    if (Harmony* harm = fd->harmony()) {
-                        appendFiltered(harm);
-                    }
-                }
-                appendFiltered(e);
+        for (EngravingItem* e : s->annotations()) {
+            if (e->track() >= startTrack && e->track() < endTrack) {
+                trackElements[e->track() - startTrack].push_back(e);
             }
+        }
+        for (track_idx_t st = startTrack; st < endTrack; ++st) {
             EngravingItem* e = s->element(st);
             if (!e || e->generated() || e->isTimeSig() || e->isKeySig()) {
                 continue;
             }
+            trackElements[st - startTrack].push_back(e);
+        }
+    }
+
+    std::unordered_set<const Beam*> appendedBeams;
+
+    for (track_idx_t st = startTrack; st < endTrack; ++st) {
+        if (!canSelectVoice(st)) {
+            continue;
+        }
+        for (EngravingItem* e : trackElements[st - startTrack]) {
+            if (e->isFretDiagram()) {
+                FretDiagram* fd = toFretDiagram(e);
+                if (Harmony* harm = fd->harmony()) {
+                    appendFiltered(harm);
+                }
+            }
 
             if (!e->isChordRest()) {
                 appendFiltered(e);
@@ -705,20 +736,31 @@ void Selection::updateSelectedElements()
                 innerTuplets.emplace(tuplet);
             }
 
-            appendChordRest(cr);
+            appendChordRest(cr, appendedBeams);
         }
     }
 
-    for (Tuplet* tuplet : innerTuplets) {
-        appendTupletHierarchy(tuplet);
+    if (!innerTuplets.empty()) {
+        std::unordered_set<const EngravingItem*> appended(m_el.begin(), m_el.end());
+        for (Tuplet* tuplet : innerTuplets) {
+            appendTupletHierarchy(tuplet, appended);
+        }
     }
 
     const Fraction rangeStart = tickStart();
     const Fraction rangeEnd = tickEnd();
 
     //! NOTE: Ties are NOT handled in here - these are note anchored and handled in appendChord...
-    for (auto i = m_score->spanner().begin(); i != m_score->spanner().end(); ++i) {
-        Spanner* sp = (*i).second;
+    std::vector<Spanner*> spanners;
+    for (const auto& interval : m_score->spannerMap().findOverlapping(rangeStart.ticks(), rangeEnd.ticks())) {
+        spanners.push_back(interval.value);
+    }
+    // keep the order of the spanner map
+    std::stable_sort(spanners.begin(), spanners.end(), [](const Spanner* s1, const Spanner* s2) {
+        return s1->tick() < s2->tick();
+    });
+
+    for (Spanner* sp : spanners) {
         // ignore spanners belonging to other tracks
         if (sp->track() < startTrack || sp->track() >= endTrack) {
             continue;
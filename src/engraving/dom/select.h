@@ -23,6 +23,8 @@
 #ifndef MU_ENGRAVING_SELECT_H
 #define MU_ENGRAVING_SELECT_H
 
+#include <unordered_set>
+
 #include "durationtype.h"
 #include "mscore.h"
 #include "pitchspelling.h"
@@ -31,6 +33,7 @@
 #include "selectionfilter.h"
 
 namespace mu::engraving {
+class Beam;
 class Score;
 class Page;
 class System;
@@ -121,6 +124,7 @@ public:
     bool isSingle() const { return (m_state == SelState::LIST) && (m_el.size() == 1); }
 
     void add(EngravingItem*);
+    void add(const std::vector<EngravingItem*>& items);
     void deselectAll();
     void remove(EngravingItem*);
     void clear();
@@ -173,9 +177,9 @@ private:
     bool canSelect(const EngravingItem* e) const { return selectionFilter().canSelect(e); }
     bool canSelectVoice(track_idx_t track) const { return selectionFilter().canSelectVoice(track); }
     void appendFiltered(EngravingItem* e);
-    void appendChordRest(ChordRest* cr);
-    void appendChord(Chord* chord);
-    void appendTupletHierarchy(Tuplet* innermostTuplet);
+    void appendChordRest(ChordRest* cr, std::unordered_set<const Beam*>& appendedBeams);
+    void appendChord(Chord* chord, std::unordered_set<const Beam*>& appendedBeams);
+    void appendTupletHierarchy(Tuplet* innermostTuplet, std::unordered_set<const EngravingItem*>& appended);
     void appendGuitarBend(GuitarBend* guitarBend);
 
     Score* m_score = nullptr;
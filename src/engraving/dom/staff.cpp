@@ -802,6 +802,11 @@ void Staff::clearTimeSig()
     m_timesigs.clear();
 }
 
+void Staff::clearTimeSig(const Fraction& fromTick)
+{
+    m_timesigs.erase(m_timesigs.lower_bound(fromTick.ticks()), m_timesigs.end());
+}
+
 //---------------------------------------------------------
 //   Staff::transpose
 //
@@ -112,6 +112,7 @@ public:
     void addTimeSig(TimeSig*);
     void removeTimeSig(TimeSig*);
     void clearTimeSig();
+    void clearTimeSig(const Fraction& fromTick);
     Fraction timeStretch(const Fraction&) const;
     TimeSig* timeSig(const Fraction&) const;
     TimeSig* nextTimeSig(const Fraction&) const;
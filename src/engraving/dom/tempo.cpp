@@ -98,7 +98,7 @@ void TempoMap::setPause(int tick, double pause)
 //   setTempo
 //---------------------------------------------------------
 
-void TempoMap::setTempo(int tick, BeatsPerSecond tempo)
+void TempoMap::setTempo(int tick, BeatsPerSecond tempo, TempoType type)
 {
     IF_ASSERT_FAILED(tempo > BeatsPerSecond(0.0)) {
         tempo = BeatsPerSecond(0.01);
@@ -106,9 +106,51 @@ void TempoMap::setTempo(int tick, BeatsPerSecond tempo)
     auto e = find(tick);
     if (e != end()) {
         e->second.tempo = tempo;
-        e->second.type |= TempoType::FIX;
+        e->second.type |= type;
     } else {
-        insert(std::pair<const int, TEvent>(tick, TEvent(tempo, 0.0, TempoType::FIX)));
+        insert(std::pair<const int, TEvent>(tick, TEvent(tempo, 0.0, type)));
+    }
+    normalize();
+}
+
+//---------------------------------------------------------
+//   takeRamps
+//    Removes the events of the given range that are only
+//    points of a tempo ramp and returns them.
+//    Start tick included, end tick excluded.
+//---------------------------------------------------------
+
+std::map<int, TEvent> TempoMap::takeRamps(int tick1, int tick2)
+{
+    std::map<int, TEvent> ramps;
+    for (auto e = lower_bound(tick1); e != end() && e->first < tick2;) {
+        if ((e->second.type & TempoType::RAMP) && !(e->second.type & (TempoType::FIX | TempoType::PAUSE))) {
+            ramps.insert(ramps.end(), *e);
+            e = erase(e);
+        } else {
+            ++e;
+        }
+    }
+
+    if (!ramps.empty()) {
+        normalize();
+    }
+    return ramps;
+}
+
+//---------------------------------------------------------
+//   restoreRamps
+//    Puts back ramp points taken by takeRamps where
+//    no other event was set meanwhile.
+//---------------------------------------------------------
+
+void TempoMap::restoreRamps(const std::map<int, TEvent>& ramps)
+{
+    if (ramps.empty()) {
+        return;
+    }
+    for (const auto& ramp : ramps) {
+        insert(ramp);
     }
     normalize();
 }
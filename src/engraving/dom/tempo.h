@@ -86,10 +86,13 @@ public:
     int time2tick(double time, int tick, int* sn) const;
     int tempoSN() const { return m_tempoSN; }
 
-    void setTempo(int t, BeatsPerSecond);
+    void setTempo(int t, BeatsPerSecond, TempoType type = TempoType::FIX);
     void setPause(int t, double);
     void delTempo(int tick);
 
+    std::map<int, TEvent> takeRamps(int tick1, int tick2);
+    void restoreRamps(const std::map<int, TEvent>& ramps);
+
     BeatsPerSecond tempoMultiplier() const;
     bool setTempoMultiplier(BeatsPerSecond val);
 
@@ -281,6 +281,8 @@ bool Score::transpose(Note* n, Interval interval, bool useDoubleSharpsFlats)
 bool Score::transpose(TransposeMode mode, TransposeDirection direction, Key trKey,
                       int transposeInterval, bool trKeys, bool transposeChordNames, bool useDoubleSharpsFlats)
 {
+    ScoreChangesBatch changesBatch(this);
+
     bool result = true;
     bool rangeSelection = selection().isRange();
     staff_idx_t startStaffIdx   = 0;
@@ -560,62 +562,86 @@ void Score::transposeKeys(staff_idx_t staffStart, staff_idx_t staffEnd, const Fr
     if (tickStart < Fraction(0, 1)) {            // -1 and 0 are valid values to indicate start of score
         tickStart = Fraction(0, 1);
     }
+
+    // all staves of the range are handled in one walk over the key signature segments
+    std::vector<staff_idx_t> staves;
     for (staff_idx_t staffIdx = staffStart; staffIdx < staffEnd; ++staffIdx) {
-        Staff* st = staff(staffIdx);
-        if (st->staffType(tickStart)->group() == StaffGroup::PERCUSSION) {
-            continue;
+        if (staff(staffIdx)->staffType(tickStart)->group() != StaffGroup::PERCUSSION) {
+            staves.push_back(staffIdx);
         }
+    }
+    if (staves.empty()) {
+        return;
+    }
 
-        bool createKey = tickStart.isZero();
-        for (Segment* s = firstSegment(SegmentType::KeySig); s; s = s->next1(SegmentType::KeySig)) {
-            if (!s->enabled() || s->tick() < tickStart) {
-                continue;
-            }
-            if (tickEnd != Fraction(-1, 1) && s->tick() >= tickEnd) {
-                break;
-            }
+    std::vector<bool> createKey(staves.size(), tickStart.isZero());
+    for (Segment* s = firstSegment(SegmentType::KeySig); s; s = s->next1(SegmentType::KeySig)) {
+        if (!s->enabled() || s->tick() < tickStart) {
+            continue;
+        }
+        if (tickEnd != Fraction(-1, 1) && s->tick() >= tickEnd) {
+            break;
+        }
+        for (size_t i = 0; i < staves.size(); ++i) {
+            staff_idx_t staffIdx = staves[i];
             KeySig* ks = toKeySig(s->element(staffIdx * VOICES));
             if (!ks || ks->generated()) {
                 continue;
             }
-            if (!ks->isAtonal()) {
-                Interval v = st->part()->instrument(s->tick())->transpose();
-                KeySigEvent ke = st->keySigEvent(s->tick());
-                PreferSharpFlat pref = ks->part()->preferSharpFlat();
-                Key nKey = ke.concertKey();
-                if (flip && !v.isZero()) {
-                    v.flip();
-                    nKey = transposeKey(ke.concertKey(), v, pref);
-                }
-
-                ke.setKey(nKey);
-                undo(new ChangeKeySig(ks, ke, ks->showCourtesy()));
-            }
             if (s->tick().isZero()) {
-                createKey = false;
+                createKey[i] = false;
+            }
+            if (ks->isAtonal()) {
+                continue;
             }
+            Staff* st = staff(staffIdx);
+            Interval v = st->part()->instrument(s->tick())->transpose();
+            KeySigEvent ke = st->keySigEvent(s->tick());
+            PreferSharpFlat pref = ks->part()->preferSharpFlat();
+            Key nKey = ke.concertKey();
+            if (flip && !v.isZero()) {
+                v.flip();
+                nKey = transposeKey(ke.concertKey(), v, pref);
+            }
+
+            ke.setKey(nKey);
+            undo(new ChangeKeySig(ks, ke, ks->showCourtesy()));
         }
-        if (createKey && firstMeasure()) {
-            Segment* seg = firstMeasure()->undoGetSegmentR(SegmentType::KeySig, Fraction(0, 1));
-            seg->setHeader(true);
-            KeySig* ks = Factory::createKeySig(seg);
-            ks->setTrack(staffIdx * VOICES);
-            Interval v = ks->part()->instrument()->transpose();
-            Key cKey = Key::C;
-            Key nKey = cKey;
-            if (flip) {
-                if (!v.isZero()) {
-                    v.flip();
-                    nKey = transposeKey(Key::C, v, ks->part()->preferSharpFlat());
-                }
-            } else {
-                cKey = transposeKey(Key::C, v);
-                nKey = cKey;
+    }
+
+    if (!firstMeasure()) {
+        return;
+    }
+
+    for (size_t i = 0; i < staves.size(); ++i) {
+        if (!createKey[i]) {
+            continue;
+        }
+        staff_idx_t staffIdx = staves[i];
+        Segment* seg = firstMeasure()->undoGetSegmentR(SegmentType::KeySig, Fraction(0, 1));
+        EngravingItem* added = seg->element(staffIdx * VOICES);
+        if (added && !added->generated()) {
+            // already added through a linked staff of the range
+            continue;
+        }
+        seg->setHeader(true);
+        KeySig* ks = Factory::createKeySig(seg);
+        ks->setTrack(staffIdx * VOICES);
+        Interval v = ks->part()->instrument()->transpose();
+        Key cKey = Key::C;
+        Key nKey = cKey;
+        if (flip) {
+            if (!v.isZero()) {
+                v.flip();
+                nKey = transposeKey(Key::C, v, ks->part()->preferSharpFlat());
             }
-            ks->setKey(cKey, nKey);
-            ks->setParent(seg);
-            undoAddElement(ks);
+        } else {
+            cKey = transposeKey(Key::C, v);
+            nKey = cKey;
         }
+        ks->setKey(cKey, nKey);
+        ks->setParent(seg);
+        undoAddElement(ks);
     }
 }
 
@@ -1741,7 +1741,7 @@ void ChangeMeasureLen::flip(EditData*)
         measure->remove(s);
     }
     measure->setTicks(len);
-    measure->score()->setUpTempoMap();
+    measure->score()->setUpTempoMap(measure);
     len = oLen;
 }
 
@@ -1756,21 +1756,53 @@ TransposeHarmony::TransposeHarmony(Harmony* h, Interval interval, bool doubleSha
     m_useDoubleSharpsFlats = doubleSharpsFlats;
 }
 
-void TransposeHarmony::flip(EditData*)
+static void transposeHarmony(Harmony* harmony, const Interval& interval, bool useDoubleSharpsFlats)
 {
-    m_harmony->realizedHarmony().setDirty(true);   // harmony should be re-realized after transposition
+    harmony->realizedHarmony().setDirty(true);   // harmony should be re-realized after transposition
 
-    for (HarmonyInfo* info : m_harmony->chords()) {
-        info->setRootTpc(transposeTpc(info->rootTpc(), m_interval, m_useDoubleSharpsFlats));
-        info->setBassTpc(transposeTpc(info->bassTpc(), m_interval, m_useDoubleSharpsFlats));
+    for (HarmonyInfo* info : harmony->chords()) {
+        info->setRootTpc(transposeTpc(info->rootTpc(), interval, useDoubleSharpsFlats));
+        info->setBassTpc(transposeTpc(info->bassTpc(), interval, useDoubleSharpsFlats));
     }
 
-    m_harmony->setXmlText(m_harmony->harmonyName());
-    m_harmony->render();
-    m_harmony->triggerLayout();
+    harmony->setXmlText(harmony->harmonyName());
+    harmony->render();
+    harmony->triggerLayout();
+}
+
+void TransposeHarmony::flip(EditData*)
+{
+    transposeHarmony(m_harmony, m_interval, m_useDoubleSharpsFlats);
     m_interval.flip();
 }
 
+//---------------------------------------------------------
+//   TransposeHarmonies
+//---------------------------------------------------------
+
+TransposeHarmonies::TransposeHarmonies(const std::vector<std::pair<Harmony*, Interval> >& harmonies, bool useDoubleSharpsFlats)
+    : m_harmonies(harmonies), m_useDoubleSharpsFlats(useDoubleSharpsFlats)
+{
+}
+
+void TransposeHarmonies::flip(EditData*)
+{
+    for (auto& [harmony, interval] : m_harmonies) {
+        transposeHarmony(harmony, interval, m_useDoubleSharpsFlats);
+        interval.flip();
+    }
+}
+
+std::vector<EngravingObject*> TransposeHarmonies::objectItems() const
+{
+    std::vector<EngravingObject*> objects;
+    objects.reserve(m_harmonies.size());
+    for (const auto& pair : m_harmonies) {
+        objects.push_back(pair.first);
+    }
+    return objects;
+}
+
 //---------------------------------------------------------
 //   TransposeHarmonyDiatonic
 //---------------------------------------------------------
@@ -2331,7 +2363,7 @@ void InsertRemoveMeasures::insertMeasures()
     score->measures()->insert(fm, lm);
 
     if (fm->isMeasure()) {
-        score->setUpTempoMap();
+        score->setUpTempoMap(fm);
         score->insertTime(fm->tick(), lm->endTick() - fm->tick());
 
         // move ownership of Instrument back to part
@@ -2515,7 +2547,8 @@ void InsertRemoveMeasures::removeMeasures()
     score->measures()->remove(fm, lm);
 
     if (fm->isMeasure()) {
-        score->setUpTempoMap();
+        // the removed measures keep their links to the neighbours
+        score->setUpTempoMap(lm->next() ? lm->next() : fm->prev());
         score->setPlaylistDirty();
 
         // check if there is a clef at the end of last measure
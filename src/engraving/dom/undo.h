@@ -596,6 +596,30 @@ public:
     UNDO_CHANGED_OBJECTS({ m_harmony })
 };
 
+//---------------------------------------------------------
+//   TransposeHarmonies
+//    transposes many chord symbols of one staff
+//    as a single undo command
+//---------------------------------------------------------
+
+class TransposeHarmonies : public UndoCommand
+{
+    OBJECT_ALLOCATOR(engraving, TransposeHarmonies)
+
+    std::vector<std::pair<Harmony*, Interval> > m_harmonies;
+    bool m_useDoubleSharpsFlats = false;
+
+    void flip(EditData*) override;
+
+public:
+    TransposeHarmonies(const std::vector<std::pair<Harmony*, Interval> >& harmonies, bool useDoubleSharpsFlats);
+
+    std::vector<EngravingObject*> objectItems() const override;
+
+    UNDO_TYPE(CommandType::TransposeHarmony)
+    UNDO_NAME("TransposeHarmonies")
+};
+
 class TransposeHarmonyDiatonic : public UndoCommand
 {
     OBJECT_ALLOCATOR(engraving, TransposeHarmonyDiatonic)
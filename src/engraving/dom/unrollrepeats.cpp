@@ -89,17 +89,18 @@ static void removeRepeatMarkings(Score* score)
 //---------------------------------------------------------
 //   createExcerpts
 //    re-create all the excerpts once the master score
-//    has been unrolled
+//    has been unrolled, in a single command so that the
+//    master score is updated once rather than per part
 //---------------------------------------------------------
 
 static void createExcerpts(MasterScore* cs, const std::list<Excerpt*>& excerpts)
 {
     // borrowed from musescore.cpp endsWith(".pdf")
+    cs->startCmd(TranslatableString("undoableAction", "Create parts"));
     for (Excerpt* e : excerpts) {
         Score* nscore = e->masterScore()->createScore();
         e->setExcerptScore(nscore);
         nscore->style().set(Sid::createMultiMeasureRests, true);
-        cs->startCmd(TranslatableString("undoableAction", "Create parts"));
         cs->undo(new AddExcerpt(e));
         Excerpt::createExcerpt(e);
 
@@ -111,9 +112,8 @@ static void createExcerpts(MasterScore* cs, const std::list<Excerpt*>& excerpts)
                 ee->parts().insert(ee->parts().end(), e->parts().begin(), e->parts().end());
             }
         }
-
-        cs->endCmd();
     }
+    cs->endCmd();
 }
 
 //---------------------------------------------------------
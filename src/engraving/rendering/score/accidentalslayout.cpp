@@ -103,7 +103,23 @@ void AccidentalsLayout::layoutAccidentals(const std::vector<Chord*>& chords, Lay
     }
 
     AccidentalsLayoutContext accidentalsLayoutContext(std::move(allAccidentals), chords);
+    createChordsShape(accidentalsLayoutContext);
+
+    if (MScore::noLayoutCaches) {
+        doAccidentalPlacement(accidentalsLayoutContext);
+        return;
+    }
+
+    std::vector<double> key = placementKey(accidentalsLayoutContext);
+    std::map<AccidentalsPlacementKey, AccidentalsPlacement>& cache = ctx.mutState().accidentalsPlacementCache();
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        applyPlacement(it->second, accidentalsLayoutContext);
+        return;
+    }
+
     doAccidentalPlacement(accidentalsLayoutContext);
+    cache.emplace(std::move(key), collectPlacement(accidentalsLayoutContext));
 }
 
 void AccidentalsLayout::collectAccidentals(const std::vector<Chord*> chords, std::vector<Accidental*>& allAccidentals,
@@ -139,8 +155,6 @@ bool AccidentalsLayout::accidentalIsRedundant(const Accidental* acc, const std::
 
 void AccidentalsLayout::doAccidentalPlacement(AccidentalsLayoutContext& ctx)
 {
-    createChordsShape(ctx);
-
     findOctavesAndSeconds(ctx);
     splitIntoSubChords(ctx);
 
@@ -151,6 +165,123 @@ void AccidentalsLayout::doAccidentalPlacement(AccidentalsLayoutContext& ctx)
     verticallyAlignAccidentals(ctx);
 }
 
+std::vector<double> AccidentalsLayout::placementKey(const AccidentalsLayoutContext& ctx)
+{
+    // Everything the placement reads: the style, the chords shape and the accidentals with their notes.
+    // The column and stacking order offset are read back by the placement, so they are part of the key too.
+    // The placement only compares lines and vertical positions with each other, so they are taken
+    // relative to the lowest accidental: the same chord set a step or an octave higher gets the same key.
+    const Accidental* lowest = ctx.allAccidentals.back();
+    const int refLine = lowest->line();
+    const double refY = lowest->note()->y();
+
+    std::vector<double> key;
+    key.reserve(8 + 7 * ctx.chordsShape.elements().size() + 16 * ctx.allAccidentals.size());
+
+    key.push_back(ctx.spatium());
+    key.push_back(ctx.accidentalAccidentalDistance());
+    key.push_back(ctx.orderFollowNoteDisplacement());
+    key.push_back(ctx.alignOctavesAcrossSubChords());
+    key.push_back(ctx.keepSecondsTogether());
+    key.push_back(ctx.alignOffsetOctaves());
+
+    key.push_back(static_cast<double>(ctx.chordsShape.elements().size()));
+    for (const ShapeElement& el : ctx.chordsShape.elements()) {
+        const EngravingItem* item = el.item();
+        key.push_back(item ? static_cast<double>(item->type()) : -1.0);
+        key.push_back(item ? item->y() - refY : 0.0);
+        key.push_back(item ? item->mag() : 0.0);
+        key.push_back(el.x());
+        key.push_back(el.y() - refY);
+        key.push_back(el.width());
+        key.push_back(el.height());
+    }
+
+    key.push_back(static_cast<double>(ctx.allAccidentals.size()));
+    for (const Accidental* acc : ctx.allAccidentals) {
+        const Note* note = acc->note();
+        const Chord* chord = note->chord();
+        key.push_back(static_cast<double>(acc->accidentalType()));
+        key.push_back(static_cast<double>(acc->bracket()));
+        key.push_back(static_cast<double>(acc->line() - refLine));
+        key.push_back(acc->mag());
+        key.push_back(acc->stackingOrderOffset());
+        key.push_back(acc->ldata()->column.value());
+        key.push_back(note->x());
+        key.push_back(note->y() - refY);
+        key.push_back(chord->x());
+        key.push_back(keepAccidentalsCloseToChord(chord));
+
+        // the shape and bbox of the accidental are made of its symbols
+        const std::vector<Accidental::LayoutData::Sym>& syms = acc->ldata()->syms;
+        key.push_back(static_cast<double>(syms.size()));
+        for (const Accidental::LayoutData::Sym& sym : syms) {
+            key.push_back(static_cast<double>(sym.sym));
+            key.push_back(sym.x);
+            key.push_back(sym.y);
+        }
+    }
+
+    return key;
+}
+
+std::vector<AccidentalPlacement> AccidentalsLayout::collectPlacement(const AccidentalsLayoutContext& ctx)
+{
+    auto indexOf = [&ctx](const Accidental* acc) {
+        return static_cast<size_t>(std::find(ctx.allAccidentals.begin(), ctx.allAccidentals.end(), acc) - ctx.allAccidentals.begin());
+    };
+
+    std::vector<AccidentalPlacement> placement;
+    placement.reserve(ctx.allAccidentals.size());
+    for (const Accidental* acc : ctx.allAccidentals) {
+        const Accidental::LayoutData* ldata = acc->ldata();
+        AccidentalPlacement p;
+        p.x = ldata->pos().x();
+        p.column = ldata->column.value();
+        p.verticalSubgroup = ldata->verticalSubgroup.value();
+        p.stackingNumber = ldata->stackingNumber.value();
+        p.stackingOrderOffset = acc->stackingOrderOffset();
+        for (const Accidental* octaveAcc : ldata->octaves.value()) {
+            p.octaves.push_back(indexOf(octaveAcc));
+        }
+        for (const Accidental* secondAcc : ldata->seconds.value()) {
+            p.seconds.push_back(indexOf(secondAcc));
+        }
+        placement.push_back(std::move(p));
+    }
+
+    return placement;
+}
+
+void AccidentalsLayout::applyPlacement(const std::vector<AccidentalPlacement>& placement, const AccidentalsLayoutContext& ctx)
+{
+    IF_ASSERT_FAILED(placement.size() == ctx.allAccidentals.size()) {
+        return;
+    }
+
+    for (size_t i = 0; i < placement.size(); ++i) {
+        const AccidentalPlacement& p = placement[i];
+        Accidental* acc = ctx.allAccidentals[i];
+        Accidental::LayoutData* ldata = acc->mutldata();
+        ldata->setPosX(p.x);
+        ldata->column = p.column;
+        ldata->verticalSubgroup = p.verticalSubgroup;
+        ldata->stackingNumber = p.stackingNumber;
+        acc->setStackingOrderOffset(p.stackingOrderOffset);
+
+        std::vector<Accidental*>& octaves = ldata->octaves.mut_value();
+        octaves.clear();
+        for (size_t idx : p.octaves) {
+            octaves.push_back(ctx.allAccidentals[idx]);
+        }
+        std::vector<Accidental*>& seconds = ldata->seconds.mut_value();
+        seconds.clear();
+        for (size_t idx : p.seconds) {
+            seconds.push_back(ctx.allAccidentals[idx]);
+        }
+    }
+}
+
 void AccidentalsLayout::findOctavesAndSeconds(const AccidentalsLayoutContext& ctx)
 {
     for (Accidental* acc1 : ctx.allAccidentals) {
@@ -35,6 +35,7 @@ struct ShapeElement;
 
 namespace mu::engraving::rendering::score {
 class LayoutContext;
+struct AccidentalPlacement;
 
 using AccidentalGroups = std::vector<std::vector<Accidental*> >;
 
@@ -105,6 +106,10 @@ private:
 
     static void doAccidentalPlacement(AccidentalsLayoutContext& ctx);
 
+    static std::vector<double> placementKey(const AccidentalsLayoutContext& ctx);
+    static std::vector<AccidentalPlacement> collectPlacement(const AccidentalsLayoutContext& ctx);
+    static void applyPlacement(const std::vector<AccidentalPlacement>& placement, const AccidentalsLayoutContext& ctx);
+
     static void findOctavesAndSeconds(const AccidentalsLayoutContext& ctx);
 
     static void splitIntoSubChords(AccidentalsLayoutContext& ctx);
@@ -55,7 +55,7 @@
 using namespace mu::engraving;
 using namespace mu::engraving::rendering::score;
 
-void BeamLayout::layout(Beam* item, const LayoutContext& ctx)
+void BeamLayout::layout(Beam* item, LayoutContext& ctx)
 {
     TRACEFUNC;
 
@@ -122,7 +122,7 @@ void BeamLayout::layout(Beam* item, const LayoutContext& ctx)
     }
 }
 
-void BeamLayout::layoutIfNeed(Beam* item, const LayoutContext& ctx)
+void BeamLayout::layoutIfNeed(Beam* item, LayoutContext& ctx)
 {
     if (!item->ldata()->isValid()) {
         BeamLayout::layout(item, ctx);
@@ -300,7 +300,7 @@ void BeamLayout::layout1(Beam* item, LayoutContext& ctx)
     }
 }
 
-void BeamLayout::layout2(Beam* item, const LayoutContext& ctx, const std::vector<ChordRest*>& chordRests, SpannerSegmentType, int frag)
+void BeamLayout::layout2(Beam* item, LayoutContext& ctx, const std::vector<ChordRest*>& chordRests, SpannerSegmentType, int frag)
 {
     TRACEFUNC;
 
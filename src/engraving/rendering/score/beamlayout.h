@@ -44,8 +44,8 @@ class BeamLayout
 {
 public:
 
-    static void layout(Beam* item, const LayoutContext& ctx);
-    static void layoutIfNeed(Beam* item, const LayoutContext& ctx);
+    static void layout(Beam* item, LayoutContext& ctx);
+    static void layoutIfNeed(Beam* item, LayoutContext& ctx);
     static void layout1(Beam* item, LayoutContext& ctx);
 
     static bool isStartOfNonCrossBeam(ChordRest* cr);
@@ -65,7 +65,7 @@ public:
 private:
     static void beamGraceNotes(LayoutContext& ctx, Chord* mainNote, bool after);
 
-    static void layout2(Beam* item, const LayoutContext& ctx, const std::vector<ChordRest*>& chordRests, SpannerSegmentType, int frag);
+    static void layout2(Beam* item, LayoutContext& ctx, const std::vector<ChordRest*>& chordRests, SpannerSegmentType, int frag);
 
     static void createBeamSegments(Beam* item, const LayoutContext& ctx, const std::vector<ChordRest*>& chordRests);
     static bool calcIsBeamletBefore(const Beam* item, Chord* chord, int i, int level, bool isAfter32Break, bool isAfter64Break);
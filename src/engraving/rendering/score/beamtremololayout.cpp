@@ -502,6 +502,57 @@ void BeamTremoloLayout::setValidBeamPositions(const BeamBase::LayoutData* ldata,
     }
 }
 
+void BeamTremoloLayout::setValidBeamPositionsCached(const BeamBase::LayoutData* ldata, LayoutContext& ctx, int& dictator,
+                                                    int& pointer, int beamCountD, int beamCountP, int staffLines, bool isStartDictator,
+                                                    bool isFlat, bool isAscending)
+{
+    if (MScore::noLayoutCaches) {
+        setValidBeamPositions(ldata, dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat, isAscending);
+        return;
+    }
+
+    BeamPositionsKey key;
+    key.dictator = dictator;
+    key.pointer = pointer;
+    key.beamCountD = beamCountD;
+    key.beamCountP = beamCountP;
+    key.staffLines = staffLines;
+    key.beamSpacing = ldata->beamSpacing;
+    key.up = ldata->up;
+    key.isStartDictator = isStartDictator;
+    key.isFlat = isFlat;
+    key.isAscending = isAscending;
+
+    if (isFlat) {
+        // flat beams also check the inner chords, so their stroke counts are part of the input
+        int shift = 0;
+        for (const ChordRest* cr : ldata->elements) {
+            if (!cr->isChord() && (cr != ldata->elements.front() && cr != ldata->elements.back())) {
+                continue;
+            }
+            int beamCount = strokeCount(ldata, cr);
+            if (shift > 60 || beamCount < 0 || beamCount > 14) {
+                // doesn't fit into the key, don't cache
+                setValidBeamPositions(ldata, dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat, isAscending);
+                return;
+            }
+            key.flatBeamCounts |= static_cast<uint64_t>(beamCount + 1) << shift;
+            shift += 4;
+        }
+    }
+
+    std::map<BeamPositionsKey, BeamPositions>& cache = ctx.mutState().beamPositionsCache();
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        dictator = it->second.first;
+        pointer = it->second.second;
+        return;
+    }
+
+    setValidBeamPositions(ldata, dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat, isAscending);
+    cache.emplace(key, BeamPositions(dictator, pointer));
+}
+
 void BeamTremoloLayout::addMiddleLineSlant(const BeamBase::LayoutData* ldata, int& dictator, int& pointer, int beamCount, int targetLine,
                                            int interval, int desiredSlant)
 {
@@ -580,7 +631,7 @@ int BeamTremoloLayout::strokeCount(const BeamBase::LayoutData* ldata, const Chor
     return strokes;
 }
 
-bool BeamTremoloLayout::calculateAnchors(const BeamBase* item, BeamBase::LayoutData* ldata, const LayoutContext& ctx,
+bool BeamTremoloLayout::calculateAnchors(const BeamBase* item, BeamBase::LayoutData* ldata, LayoutContext& ctx,
                                          const std::vector<ChordRest*>& chordRests,
                                          const std::vector<BeamBase::NotePosition>& notePositions)
 {
@@ -750,7 +801,8 @@ bool BeamTremoloLayout::calculateAnchors(const BeamBase* item, BeamBase::LayoutD
     int beamCount = std::max(beamCountD, beamCountP);
     if (!ldata->tab) {
         if (!ldata->isGrace) {
-            setValidBeamPositions(ldata, dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat, isAscending);
+            setValidBeamPositionsCached(ldata, ctx, dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat,
+                                        isAscending);
         }
         if (!forceFlat) {
             addMiddleLineSlant(ldata, dictator, pointer, beamCount, targetLine, interval, smallSlant ? 1 : slant);
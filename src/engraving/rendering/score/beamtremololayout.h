@@ -53,7 +53,7 @@ public:
 
     static void setupLData(const BeamBase* item, BeamBase::LayoutData* ldata, const LayoutContext& ctx);
 
-    static bool calculateAnchors(const BeamBase* item, BeamBase::LayoutData* ldata, const LayoutContext& ctx,
+    static bool calculateAnchors(const BeamBase* item, BeamBase::LayoutData* ldata, LayoutContext& ctx,
                                  const std::vector<ChordRest*>& chordRests, const std::vector<BeamBase::NotePosition>& notePositions);
 
     static double chordBeamAnchorX(const BeamBase::LayoutData* ldata, const ChordRest* chord, ChordBeamAnchorType anchorType);
@@ -91,6 +91,9 @@ private:
                                    bool isAscending, bool isFlat);
     static void setValidBeamPositions(const BeamBase::LayoutData* ldata, int& dictator, int& pointer, int beamCountD, int beamCountP,
                                       int staffLines, bool isStartDictator, bool isFlat, bool isAscending);
+    static void setValidBeamPositionsCached(const BeamBase::LayoutData* ldata, LayoutContext& ctx, int& dictator, int& pointer,
+                                            int beamCountD, int beamCountP, int staffLines, bool isStartDictator, bool isFlat,
+                                            bool isAscending);
     static void addMiddleLineSlant(const BeamBase::LayoutData* ldata, int& dictator, int& pointer, int beamCount, int targetLine,
                                    int interval, int desiredSlant);
     static void add8thSpaceSlant(BeamBase::LayoutData* ldata, PointF& dictatorAnchor, int dictator, int pointer, int beamCount,
@@ -1459,7 +1459,7 @@ bool ChordLayout::isChordPosBelowTrem(const Chord* item, TremoloTwoChord* trem)
     return noteY > tremY;
 }
 
-static bool computeUp_TremoloTwoNotesCase(const Chord* item, TremoloTwoChord* tremolo, const LayoutContext& ctx)
+static bool computeUp_TremoloTwoNotesCase(const Chord* item, TremoloTwoChord* tremolo, LayoutContext& ctx)
 {
     const Chord* c1 = tremolo->chord1();
     const Chord* c2 = tremolo->chord2();
@@ -1504,7 +1504,7 @@ static bool computeUp_TremoloTwoNotesCase(const Chord* item, TremoloTwoChord* tr
     return item->ldata()->up;
 }
 
-void ChordLayout::computeUp(const Chord* item, Chord::LayoutData* ldata, const LayoutContext& ctx)
+void ChordLayout::computeUp(const Chord* item, ChordRest::LayoutData* ldata, LayoutContext& ctx)
 {
     LAYOUT_CALL() << LAYOUT_ITEM_INFO(item);
 
@@ -1576,7 +1576,7 @@ void ChordLayout::computeUp(const Chord* item, Chord::LayoutData* ldata, const L
     ldata->up = direction > 0;
 }
 
-void ChordLayout::computeUp(ChordRest* item, const LayoutContext& ctx)
+void ChordLayout::computeUp(ChordRest* item, LayoutContext& ctx)
 {
     if (item->isChord()) {
         Chord* ch = item_cast<Chord*>(item);
@@ -3511,7 +3511,7 @@ void ChordLayout::checkAndFillShape(const ChordRest* item, ChordRest::LayoutData
 #endif
 }
 
-void ChordLayout::fillShape(const ChordRest* item, Chord::LayoutData* ldata, const LayoutConfiguration& conf)
+void ChordLayout::fillShape(const ChordRest* item, ChordRest::LayoutData* ldata, const LayoutConfiguration& conf)
 {
     switch (item->type()) {
     case ElementType::CHORD:
@@ -3570,7 +3570,7 @@ bool ChordLayout::leaveSpaceForTie(const Articulation* item)
     return leaveSpace;
 }
 
-void ChordLayout::fillShape(const Chord* item, ChordRest::LayoutData* ldata)
+void ChordLayout::fillShape(const Chord* item, Chord::LayoutData* ldata)
 {
     Shape shape(Shape::Type::Composite);
 
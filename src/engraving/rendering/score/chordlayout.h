@@ -95,8 +95,8 @@ public:
 
     static void layoutStem(Chord* item, const LayoutContext& ctx);
 
-    static void computeUp(const Chord* item, ChordRest::LayoutData* ldata, const LayoutContext& ctx);
-    static void computeUp(ChordRest* item, const LayoutContext& ctx);
+    static void computeUp(const Chord* item, ChordRest::LayoutData* ldata, LayoutContext& ctx);
+    static void computeUp(ChordRest* item, LayoutContext& ctx);
     static int computeAutoStemDirection(const std::vector<int>& noteDistances);
     static bool isChordPosBelowBeam(Chord* item, Beam* beam);
     static bool isChordPosBelowTrem(const Chord* item, TremoloTwoChord* trem);
@@ -121,7 +121,7 @@ public:
     static void checkStartEndSlurs(Chord* chord, LayoutContext& ctx);
 
     static void checkAndFillShape(const ChordRest* item, ChordRest::LayoutData* ldata, const LayoutConfiguration& conf);
-    static void fillShape(const ChordRest* item, Chord::LayoutData* ldata, const LayoutConfiguration& conf);
+    static void fillShape(const ChordRest* item, ChordRest::LayoutData* ldata, const LayoutConfiguration& conf);
     static void fillShape(const Chord* item, Chord::LayoutData* ldata);
     static void fillShape(const Rest* item, Rest::LayoutData* ldata);
     static void fillShape(const MeasureRepeat* item, MeasureRepeat::LayoutData* ldata, const LayoutConfiguration& conf);
@@ -22,8 +22,10 @@
 #ifndef MU_ENGRAVING_LAYOUTCONTEXT_DEV_H
 #define MU_ENGRAVING_LAYOUTCONTEXT_DEV_H
 
-#include <vector>
+#include <map>
 #include <set>
+#include <tuple>
+#include <vector>
 
 #include "../../types/fraction.h"
 #include "../../types/types.h"
@@ -67,6 +69,7 @@ class SystemLocks;
 class Staff;
 class Measure;
 class ChordRest;
+class Lyrics;
 class Segment;
 
 class UndoCommand;
@@ -212,6 +215,52 @@ private:
     IGetScoreInternal* m_getScore = nullptr;
 };
 
+//! NOTE Normalized input of the search for valid beam positions (see BeamTremoloLayout::setValidBeamPositions),
+//! positions are in quarter spaces relative to the top staff line
+struct BeamPositionsKey {
+    int dictator = 0;
+    int pointer = 0;
+    int beamCountD = 0;
+    int beamCountP = 0;
+    int staffLines = 0;
+    int beamSpacing = 0;
+    uint64_t flatBeamCounts = 0; // stroke counts of the chords of a flat beam, 4 bits each
+    bool up = false;
+    bool isStartDictator = false;
+    bool isFlat = false;
+    bool isAscending = false;
+
+    bool operator<(const BeamPositionsKey& k) const
+    {
+        return std::tie(dictator, pointer, beamCountD, beamCountP, staffLines, beamSpacing, flatBeamCounts, up, isStartDictator, isFlat,
+                        isAscending)
+               < std::tie(k.dictator, k.pointer, k.beamCountD, k.beamCountP, k.staffLines, k.beamSpacing, k.flatBeamCounts, k.up,
+                          k.isStartDictator, k.isFlat, k.isAscending);
+    }
+};
+
+// dictator, pointer
+using BeamPositions = std::pair<int, int>;
+
+//! NOTE Placement of one accidental of a chord set (see AccidentalsLayout::layoutAccidentals),
+//! octaves and seconds are indices into the top-down sorted accidentals of the set
+struct AccidentalPlacement {
+    double x = 0.0;
+    int column = 0;
+    int verticalSubgroup = 0;
+    int stackingNumber = 0;
+    int stackingOrderOffset = 0;
+    std::vector<size_t> octaves;
+    std::vector<size_t> seconds;
+};
+
+// style values, chord shape and accidentals of a chord set, flattened
+using AccidentalsPlacementKey = std::vector<double>;
+using AccidentalsPlacement = std::vector<AccidentalPlacement>;
+
+// (track, verse) -> lyrics by tick of their chord rest
+using LyricsIndex = std::map<std::pair<track_idx_t, int>, std::map<Fraction, Lyrics*> >;
+
 class LayoutState
 {
 public:
@@ -225,6 +274,10 @@ public:
     const Fraction& startTick() const { return m_startTick; }
     const Fraction& endTick() const { return m_endTick; }
     bool isLayoutAll() const { return m_isLayoutAll; }
+    //! NOTE The range passed to the layout, before it is extended to whole systems,
+    //! nothing outside of it changed since the previous layout unless isLayoutAll()
+    const Fraction& changedStartTick() const { return m_changedStartTick; }
+    const Fraction& changedEndTick() const { return m_changedEndTick; }
 
     const Page* page() const { return m_page; }
     page_idx_t pageIdx() const { return m_pageIdx; }
@@ -253,6 +306,7 @@ public:
     void setStartTick(const Fraction& t) { m_startTick = t; }
     void setEndTick(const Fraction& t) { m_endTick = t; }
     void setIsLayoutAll(bool v) { m_isLayoutAll = v; }
+    void setChangedRange(const Fraction& stick, const Fraction& etick) { m_changedStartTick = stick; m_changedEndTick = etick; }
 
     Page* page() { return m_page; }
     void setPage(Page* p) { m_page = p; }
@@ -281,6 +335,16 @@ public:
 
     void setTotalBracketsWidth(double val) { m_totalBracketsWidth = val; }
 
+    //! NOTE Beams with the same normalized input get the same positions, ostinatos and repeated figures skip the search
+    std::map<BeamPositionsKey, BeamPositions>& beamPositionsCache() { return m_beamPositionsCache; }
+
+    //! NOTE Chord sets with the same accidentals and chord shape get the same placement
+    std::map<AccidentalsPlacementKey, AccidentalsPlacement>& accidentalsPlacementCache() { return m_accidentalsPlacementCache; }
+
+    bool isLyricsIndexBuilt() const { return m_lyricsIndexBuilt; }
+    const LyricsIndex& lyricsIndex() const { return m_lyricsIndex; }
+    void setLyricsIndex(LyricsIndex&& index) { m_lyricsIndex = std::move(index); m_lyricsIndexBuilt = true; }
+
 private:
 
     bool m_firstSystem = true;
@@ -291,6 +355,8 @@ private:
     Fraction m_startTick;
     Fraction m_endTick;
     bool m_isLayoutAll = false;
+    Fraction m_changedStartTick;
+    Fraction m_changedEndTick;
 
     Page* m_page = nullptr;
     page_idx_t m_pageIdx = 0;               // index in Score->page()s
@@ -312,6 +378,10 @@ private:
 
     // cache
     double m_totalBracketsWidth = -1.0;
+    std::map<BeamPositionsKey, BeamPositions> m_beamPositionsCache;
+    std::map<AccidentalsPlacementKey, AccidentalsPlacement> m_accidentalsPlacementCache;
+    bool m_lyricsIndexBuilt = false;
+    LyricsIndex m_lyricsIndex;
 };
 
 class LayoutDebug
@@ -249,9 +249,9 @@ void LyricsLayout::layout(LyricsLineSegment* item, LayoutContext& ctx)
     ldata->clearDashes();
 
     if (item->lyricsLine()->isEndMelisma()) {
-        layoutMelismaLine(item);
+        layoutMelismaLine(item, ctx);
     } else {
-        layoutDashes(item);
+        layoutDashes(item, ctx);
     }
 
     double halfLineWidth = item->absoluteFromSpatium(item->lineWidth());
@@ -261,7 +261,7 @@ void LyricsLayout::layout(LyricsLineSegment* item, LayoutContext& ctx)
     ldata->setShape(Shape(rect, item));
 }
 
-void LyricsLayout::layoutMelismaLine(LyricsLineSegment* item)
+void LyricsLayout::layoutMelismaLine(LyricsLineSegment* item, LayoutContext& ctx)
 {
     const bool isPartialLyricsLine = item->isPartialLyricsLineSegment();
     LyricsLine* lyricsLine = item->lyricsLine();
@@ -286,7 +286,7 @@ void LyricsLayout::layoutMelismaLine(LyricsLineSegment* item)
         }
     }
 
-    adjustLyricsLineYOffset(item);
+    adjustLyricsLineYOffset(item, ctx);
 
     double y = 0.0; // actual value is set later
 
@@ -296,7 +296,7 @@ void LyricsLayout::layoutMelismaLine(LyricsLineSegment* item)
     item->mutldata()->addDash(LineF(PointF(), item->pos2()));
 }
 
-void LyricsLayout::layoutDashes(LyricsLineSegment* item)
+void LyricsLayout::layoutDashes(LyricsLineSegment* item, LayoutContext& ctx)
 {
     const bool isPartialLyricsLine = item->isPartialLyricsLineSegment();
     LyricsLine* lyricsLine = item->lyricsLine();
@@ -336,7 +336,7 @@ void LyricsLayout::layoutDashes(LyricsLineSegment* item)
         endX = startCR ? startCR->measure()->endingXForOpenEndedLines() : endX;
     }
 
-    adjustLyricsLineYOffset(item, endLyrics);
+    adjustLyricsLineYOffset(item, ctx, endLyrics);
 
     double y = 0.0; // actual value is set later
 
@@ -397,17 +397,26 @@ void LyricsLayout::layoutDashes(LyricsLineSegment* item)
     }
 }
 
-Lyrics* LyricsLayout::findNextLyrics(const ChordRest* endChordRest, int verseNumber)
+Lyrics* LyricsLayout::findNextLyrics(const ChordRest* endChordRest, int verseNumber, LayoutContext& ctx)
 {
     if (!endChordRest) {
         return nullptr;
     }
-    for (Segment* segment = endChordRest->segment()->next1(SegmentType::ChordRest); segment;
-         segment = segment->next1(SegmentType::ChordRest)) {
-        if (!segment->elementAt(endChordRest->track())) {
+
+    // Usually the next lyrics are close by, so look there first. Past that (instrumental passages,
+    // last syllables of a section) use the index instead of walking to the end of the score.
+    // Multimeasure rests are not in the index, which follows the measures of the score.
+    static constexpr int NEARBY_SEGMENTS_COUNT = 32;
+    const bool useIndex = !endChordRest->measure()->isMMRest();
+    const track_idx_t track = endChordRest->track();
+
+    int count = 0;
+    Segment* segment = endChordRest->segment()->next1(SegmentType::ChordRest);
+    for (; segment && (!useIndex || count < NEARBY_SEGMENTS_COUNT); segment = segment->next1(SegmentType::ChordRest), ++count) {
+        if (!segment->elementAt(track)) {
             continue;
         }
-        ChordRest* nextCR = toChordRest(segment->elementAt(endChordRest->track()));
+        ChordRest* nextCR = toChordRest(segment->elementAt(track));
         for (Lyrics* lyr : nextCR->lyrics()) {
             if (lyr->no() == verseNumber) {
                 return lyr;
@@ -415,7 +424,43 @@ Lyrics* LyricsLayout::findNextLyrics(const ChordRest* endChordRest, int verseNum
         }
     }
 
-    return nullptr;
+    if (!segment) {
+        return nullptr;
+    }
+
+    if (!ctx.state().isLyricsIndexBuilt()) {
+        buildLyricsIndex(ctx);
+    }
+
+    const LyricsIndex& index = ctx.state().lyricsIndex();
+    auto verseIt = index.find({ track, verseNumber });
+    if (verseIt == index.end()) {
+        return nullptr;
+    }
+
+    auto lyricsIt = verseIt->second.lower_bound(segment->tick());
+    return lyricsIt != verseIt->second.end() ? lyricsIt->second : nullptr;
+}
+
+void LyricsLayout::buildLyricsIndex(LayoutContext& ctx)
+{
+    // Lyrics don't change during layout, so the index is built once per layout run
+    LyricsIndex index;
+    for (Measure* measure = ctx.mutDom().firstMeasure(); measure; measure = measure->nextMeasure()) {
+        for (Segment* segment = measure->first(SegmentType::ChordRest); segment; segment = segment->next(SegmentType::ChordRest)) {
+            for (EngravingItem* item : segment->elist()) {
+                if (!item || !item->isChordRest()) {
+                    continue;
+                }
+                for (Lyrics* lyr : toChordRest(item)->lyrics()) {
+                    // keep the first one, like a search through the lyrics of the chord rest would
+                    index[{ item->track(), lyr->no() }].emplace(segment->tick(), lyr);
+                }
+            }
+        }
+    }
+
+    ctx.mutState().setLyricsIndex(std::move(index));
 }
 
 void LyricsLayout::createOrRemoveLyricsLine(Lyrics* item, LayoutContext& ctx)
@@ -544,23 +589,20 @@ void LyricsLayout::computeVerticalPositions(System* system, LayoutContext& ctx)
 {
     staff_idx_t nStaves = system->score()->nstaves();
 
-    std::vector<staff_idx_t> visibleStaves;
-    visibleStaves.reserve(system->staves().size());
+    std::vector<LyricsVersesMap> lyricsVersesAbove(nStaves);
+    std::vector<LyricsVersesMap> lyricsVersesBelow(nStaves);
+    collectLyricsVerses(system, lyricsVersesAbove, lyricsVersesBelow);
 
     for (staff_idx_t staffIdx = 0; staffIdx < nStaves; ++staffIdx) {
         if (system->staff(staffIdx)->show()) {
-            computeVerticalPositions(staffIdx, system, ctx);
+            computeVerticalPositions(staffIdx, system, ctx, lyricsVersesAbove[staffIdx], lyricsVersesBelow[staffIdx]);
         }
     }
 }
 
-void LyricsLayout::computeVerticalPositions(staff_idx_t staffIdx, System* system, LayoutContext& ctx)
+void LyricsLayout::computeVerticalPositions(staff_idx_t staffIdx, System* system, LayoutContext& ctx,
+                                            const LyricsVersesMap& lyricsVersesAbove, const LyricsVersesMap& lyricsVersesBelow)
 {
-    LyricsVersesMap lyricsVersesAbove;
-    LyricsVersesMap lyricsVersesBelow;
-
-    collectLyricsVerses(staffIdx, system, lyricsVersesAbove, lyricsVersesBelow);
-
     setDefaultPositions(staffIdx, lyricsVersesAbove, lyricsVersesBelow, ctx);
 
     checkCollisionsWithStaffElements(system, staffIdx, ctx, lyricsVersesAbove, lyricsVersesBelow);
@@ -568,12 +610,10 @@ void LyricsLayout::computeVerticalPositions(staff_idx_t staffIdx, System* system
     addToSkyline(system, staffIdx, ctx, lyricsVersesAbove, lyricsVersesBelow);
 }
 
-void LyricsLayout::collectLyricsVerses(staff_idx_t staffIdx, System* system, LyricsVersesMap& lyricsVersesAbove,
-                                       LyricsVersesMap& lyricsVersesBelow)
+void LyricsLayout::collectLyricsVerses(System* system, std::vector<LyricsVersesMap>& lyricsVersesAbove,
+                                       std::vector<LyricsVersesMap>& lyricsVersesBelow)
 {
-    track_idx_t startTrack = staffIdx * VOICES;
-    track_idx_t endTrack = startTrack + VOICES;
-
+    // One pass over the system for all staves, the verses of each staff keep the segment and track order
     for (MeasureBase* mb : system->measures()) {
         if (!mb->isMeasure()) {
             continue;
@@ -582,17 +622,20 @@ void LyricsLayout::collectLyricsVerses(staff_idx_t staffIdx, System* system, Lyr
             if (!segment.isChordRestType()) {
                 continue;
             }
-            for (track_idx_t track = startTrack; track < endTrack; ++track) {
-                EngravingItem* element = segment.elementAt(track);
+            for (EngravingItem* element : segment.elist()) {
                 if (!element) {
                     continue;
                 }
+                staff_idx_t staffIdx = element->staffIdx();
+                if (staffIdx >= lyricsVersesAbove.size() || !system->staff(staffIdx)->show()) {
+                    continue;
+                }
                 for (Lyrics* lyrics : toChordRest(element)->lyrics()) {
                     int verse = lyrics->no();
                     if (lyrics->placeAbove()) {
-                        lyricsVersesAbove[verse].addLyrics(lyrics);
+                        lyricsVersesAbove[staffIdx][verse].addLyrics(lyrics);
                     } else {
-                        lyricsVersesBelow[verse].addLyrics(lyrics);
+                        lyricsVersesBelow[staffIdx][verse].addLyrics(lyrics);
                     }
                 }
             }
@@ -600,17 +643,22 @@ void LyricsLayout::collectLyricsVerses(staff_idx_t staffIdx, System* system, Lyr
     }
 
     for (SpannerSegment* spannerSegment : system->spannerSegments()) {
-        if (spannerSegment->staffIdx() == staffIdx && spannerSegment->isLyricsLineSegment()) {
-            if (muse::RealIsNull(spannerSegment->pos2().x())) {
-                continue;
-            }
-            LyricsLineSegment* lyricsLineSegment = toLyricsLineSegment(spannerSegment);
-            int verse = lyricsLineSegment->no();
-            if (lyricsLineSegment->lyricsPlaceAbove()) {
-                lyricsVersesAbove[verse].addLine(lyricsLineSegment);
-            } else {
-                lyricsVersesBelow[verse].addLine(lyricsLineSegment);
-            }
+        if (!spannerSegment->isLyricsLineSegment()) {
+            continue;
+        }
+        staff_idx_t staffIdx = spannerSegment->staffIdx();
+        if (staffIdx >= lyricsVersesAbove.size() || !system->staff(staffIdx)->show()) {
+            continue;
+        }
+        if (muse::RealIsNull(spannerSegment->pos2().x())) {
+            continue;
+        }
+        LyricsLineSegment* lyricsLineSegment = toLyricsLineSegment(spannerSegment);
+        int verse = lyricsLineSegment->no();
+        if (lyricsLineSegment->lyricsPlaceAbove()) {
+            lyricsVersesAbove[staffIdx][verse].addLine(lyricsLineSegment);
+        } else {
+            lyricsVersesBelow[staffIdx][verse].addLine(lyricsLineSegment);
         }
     }
 }
@@ -866,7 +914,7 @@ double LyricsLayout::lyricsLineEndX(const LyricsLineSegment* item, const Lyrics*
     return endChordRest->pageX() - systemPageX + endChordRest->rightEdge();
 }
 
-void LyricsLayout::adjustLyricsLineYOffset(LyricsLineSegment* item, const Lyrics* endLyrics)
+void LyricsLayout::adjustLyricsLineYOffset(LyricsLineSegment* item, LayoutContext& ctx, const Lyrics* endLyrics)
 {
     const LyricsLine* lyricsLine = item->lyricsLine();
     ChordRest* endChordRest = lyricsLine->endElement()
@@ -876,7 +924,7 @@ void LyricsLayout::adjustLyricsLineYOffset(LyricsLineSegment* item, const Lyrics
 
     // Partial melisma or dashes
     if (lyricsLine->isPartialLyricsLine()) {
-        Lyrics* nextLyrics = findNextLyrics(endChordRest, item->no());
+        Lyrics* nextLyrics = findNextLyrics(endChordRest, item->no(), ctx);
         item->ryoffset() = nextLyrics ? nextLyrics->offset().y() : item->offset().y();
         return;
     }
@@ -887,7 +935,7 @@ void LyricsLayout::adjustLyricsLineYOffset(LyricsLineSegment* item, const Lyrics
     }
 
     if (melisma || !endLyrics) {
-        Lyrics* nextLyrics = findNextLyrics(endChordRest, item->no());
+        Lyrics* nextLyrics = findNextLyrics(endChordRest, item->no(), ctx);
         item->ryoffset() = nextLyrics ? nextLyrics->offset().y() : startLyrics->offset().y();
         return;
     }
@@ -62,14 +62,16 @@ public:
 private:
     static void createOrRemoveLyricsLine(Lyrics* item, LayoutContext& ctx);
 
-    static void layoutMelismaLine(LyricsLineSegment* item);
-    static void layoutDashes(LyricsLineSegment* item);
+    static void layoutMelismaLine(LyricsLineSegment* item, LayoutContext& ctx);
+    static void layoutDashes(LyricsLineSegment* item, LayoutContext& ctx);
 
-    static Lyrics* findNextLyrics(const ChordRest* endChordRest, int verseNumber);
+    static Lyrics* findNextLyrics(const ChordRest* endChordRest, int verseNumber, LayoutContext& ctx);
+    static void buildLyricsIndex(LayoutContext& ctx);
 
-    static void computeVerticalPositions(staff_idx_t staffIdx, System* system, LayoutContext& ctx);
-    static void collectLyricsVerses(staff_idx_t staffIdx, System* system, LyricsVersesMap& lyricsVersesAbove,
-                                    LyricsVersesMap& lyricsVersesBelow);
+    static void computeVerticalPositions(staff_idx_t staffIdx, System* system, LayoutContext& ctx,
+                                         const LyricsVersesMap& lyricsVersesAbove, const LyricsVersesMap& lyricsVersesBelow);
+    static void collectLyricsVerses(System* system, std::vector<LyricsVersesMap>& lyricsVersesAbove,
+                                    std::vector<LyricsVersesMap>& lyricsVersesBelow);
 
     static void setDefaultPositions(staff_idx_t staffIdx, const LyricsVersesMap& lyricsVersesAbove,
                                     const LyricsVersesMap& lyricsVersesBelow, LayoutContext& ctx);
@@ -84,7 +86,7 @@ private:
 
     static double lyricsLineStartX(const LyricsLineSegment* item);
     static double lyricsLineEndX(const LyricsLineSegment* item, const Lyrics* endLyrics = nullptr);
-    static void adjustLyricsLineYOffset(LyricsLineSegment* item, const Lyrics* endLyrics = nullptr);
+    static void adjustLyricsLineYOffset(LyricsLineSegment* item, LayoutContext& ctx, const Lyrics* endLyrics = nullptr);
 };
 }
 #endif // MU_ENGRAVING_LYRICSLAYOUT_DEV_H
@@ -782,6 +782,107 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
     return false;
 }
 
+//---------------------------------------------------------
+//  unchangedMMRestLastMeasure
+//    if the multi measure rest starting at firstMeasure
+//    was built by a previous layout and neither its measures
+//    nor the measures around it changed since, return the
+//    last measure it spans
+//---------------------------------------------------------
+
+static Measure* unchangedMMRestLastMeasure(const LayoutContext& ctx, Measure* firstMeasure)
+{
+    const LayoutState& state = ctx.state();
+    const Measure* mmrMeasure = firstMeasure->mmRest();
+    if (state.isLayoutAll() || !mmrMeasure || mmrMeasure->mmRestCount() < 1) {
+        return nullptr;
+    }
+
+    // an edit before the mmrest may have moved its measures
+    if (mmrMeasure->tick() != firstMeasure->tick()) {
+        return nullptr;
+    }
+
+    // the ambitus depends on the notes of the whole staff
+    if (firstMeasure->findSegmentR(SegmentType::Ambitus, Fraction(0, 1))) {
+        return nullptr;
+    }
+
+    Measure* lastMeasure = firstMeasure;
+    Fraction len = firstMeasure->ticks();
+    for (int i = 1; i < mmrMeasure->mmRestCount(); ++i) {
+        MeasureBase* nextMeasureBase = ctx.conf().isShowVBox() ? lastMeasure->next() : lastMeasure->nextMeasure();
+        if (!(nextMeasureBase && nextMeasureBase->isMeasure())) {
+            return nullptr;
+        }
+        lastMeasure = toMeasure(nextMeasureBase);
+        if (lastMeasure->mmRestCount() != -1) {
+            return nullptr;
+        }
+        len += lastMeasure->ticks();
+    }
+    if (len != mmrMeasure->ticks()) {
+        return nullptr;
+    }
+
+    // the previous and the next measure decide where the run breaks
+    const Measure* prevMeasure = firstMeasure->prevMeasure();
+    const MeasureBase* nextMeasureBase = ctx.conf().isShowVBox() ? lastMeasure->next() : lastMeasure->nextMeasure();
+    Fraction runStart = prevMeasure ? prevMeasure->tick() : firstMeasure->tick();
+    Fraction runEnd = nextMeasureBase ? nextMeasureBase->endTick() : lastMeasure->endTick();
+    if (state.changedStartTick() <= runEnd && state.changedEndTick() >= runStart) {
+        return nullptr;
+    }
+
+    return lastMeasure;
+}
+
+//---------------------------------------------------------
+//  restoreMMRestSegments
+//    reset the segment flags of an unchanged multi measure
+//    rest as createMMRest does, system layout may have
+//    changed them for a header or trailer
+//---------------------------------------------------------
+
+static void restoreMMRestSegments(Measure* mmrMeasure, Measure* firstMeasure, Measure* lastMeasure)
+{
+    MeasureLayout::removeSystemTrailer(mmrMeasure);
+
+    Segment* underlyingSeg = lastMeasure->findSegmentR(SegmentType::Clef, lastMeasure->ticks());
+    Segment* mmrSeg = mmrMeasure->findSegment(SegmentType::Clef, lastMeasure->endTick());
+    if (underlyingSeg && mmrSeg) {
+        mmrSeg->setEnabled(underlyingSeg->enabled());
+        mmrSeg->setTrailer(underlyingSeg->trailer());
+    }
+
+    underlyingSeg = firstMeasure->findSegmentR(SegmentType::TimeSig, Fraction(0, 1));
+    mmrSeg = mmrMeasure->findSegment(SegmentType::TimeSig, firstMeasure->tick());
+    if (underlyingSeg && mmrSeg) {
+        mmrSeg->setEnabled(underlyingSeg->enabled());
+        mmrSeg->setHeader(underlyingSeg->header());
+    }
+
+    underlyingSeg = lastMeasure->findSegmentR(SegmentType::TimeSig, lastMeasure->ticks());
+    mmrSeg = mmrMeasure->findSegmentR(SegmentType::TimeSig, mmrMeasure->ticks());
+    if (underlyingSeg && mmrSeg) {
+        mmrSeg->setEnabled(underlyingSeg->enabled());
+        mmrSeg->setHeader(underlyingSeg->header());
+        mmrSeg->setEndOfMeasureChange(underlyingSeg->endOfMeasureChange());
+    }
+
+    underlyingSeg = firstMeasure->findSegmentR(SegmentType::KeySig, Fraction(0, 1));
+    mmrSeg = mmrMeasure->findSegmentR(SegmentType::KeySig, Fraction(0, 1));
+    if (underlyingSeg && mmrSeg) {
+        mmrSeg->setEnabled(underlyingSeg->enabled());
+        mmrSeg->setHeader(underlyingSeg->header());
+    } else if (mmrSeg) {
+        mmrSeg->setEnabled(false);
+    }
+
+    mmrMeasure->checkHeader();
+    mmrMeasure->checkTrailer();
+}
+
 void MeasureLayout::moveToNextMeasure(LayoutContext& ctx)
 {
     LAYOUT_CALL();
@@ -809,6 +910,30 @@ void MeasureLayout::createMultiMeasureRestsIfNeed(MeasureBase* currentMB, Layout
     Measure* firstMeasure = toMeasure(currentMB);
 
     if (ctx.conf().styleB(Sid::createMultiMeasureRests)) {
+        if (Measure* lastMeasure = unchangedMMRestLastMeasure(ctx, firstMeasure)) {
+            // keep the existing mmrest, only the numbering and links may have changed
+            for (Measure* m = firstMeasure->nextMeasure(); m; m = m->nextMeasure()) {
+                int measureNo = adjustMeasureNo(m, ctx.state().measureNo());
+                ctx.mutState().setMeasureNo(measureNo);
+                if (m == lastMeasure) {
+                    break;
+                }
+            }
+
+            Measure* mmrMeasure = firstMeasure->mmRest();
+            restoreMMRestSegments(mmrMeasure, firstMeasure, lastMeasure);
+            mmrMeasure->setNo(firstMeasure->no());
+            ctx.mutDom().updateSystemLocksOnCreateMMRest(firstMeasure, lastMeasure);
+
+            MeasureBase* nm = ctx.conf().isShowVBox() ? lastMeasure->next() : lastMeasure->nextMeasure();
+            mmrMeasure->setNext(nm);
+            mmrMeasure->setPrev(firstMeasure->prev());
+
+            ctx.mutState().setCurMeasure(mmrMeasure);
+            ctx.mutState().setNextMeasure(nm);
+            return;
+        }
+
         Measure* measureToBeChecked = firstMeasure;
         Measure* lastMeasure = measureToBeChecked;
         int n       = 0;
@@ -185,7 +185,7 @@ void SegmentLayout::layoutChordDrumset(const Staff* staff, const Segment& segmen
     }
 }
 
-void SegmentLayout::computeChordsUp(const Segment& segment, track_idx_t startTrack, track_idx_t endTrack, const LayoutContext& ctx)
+void SegmentLayout::computeChordsUp(const Segment& segment, track_idx_t startTrack, track_idx_t endTrack, LayoutContext& ctx)
 {
     IF_ASSERT_FAILED(segment.isJustType(SegmentType::ChordRest)) {
         return;
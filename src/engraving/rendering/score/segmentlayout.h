@@ -37,7 +37,7 @@ public:
     static void layoutChordDrumset(const Staff* staff, const Segment& segment, track_idx_t startTrack, track_idx_t endTrack,
                                    const LayoutConfiguration& conf);
 
-    static void computeChordsUp(const Segment& segment, track_idx_t startTrack, track_idx_t endTrack, const LayoutContext& ctx);
+    static void computeChordsUp(const Segment& segment, track_idx_t startTrack, track_idx_t endTrack, LayoutContext& ctx);
 
     static void layoutChordsStem(const Segment& segment, track_idx_t startTrack, track_idx_t endTrack, const LayoutContext& ctx);
 };
@@ -39,6 +39,74 @@ using namespace mu::engraving::rendering::score;
 ///   using integers to eliminate all possibilities for rounding errors
 //-----------------------------------------------------------------------------
 double StemLayout::calcDefaultStemLength(Chord* item, const LayoutContext& ctx)
+{
+    // the minimum length with a single chord tremolo depends on the tremolo and hook glyphs, which are not part of the input
+    if (item->tremoloSingleChord() || MScore::noLayoutCaches) {
+        return doCalcDefaultStemLength(item, ctx);
+    }
+
+    std::optional<StemLengthInput> input = stemLengthInput(item, ctx);
+    if (!input) {
+        return doCalcDefaultStemLength(item, ctx);
+    }
+
+    // the length from the previous layout is still valid if the chord, its staff and the style didn't change
+    Chord::LayoutData* ldata = item->mutldata();
+    if (ldata->stemLengthInput == input) {
+        return ldata->stemLength;
+    }
+
+    ldata->stemLength = doCalcDefaultStemLength(item, ctx);
+    ldata->stemLengthInput = input;
+    return ldata->stemLength;
+}
+
+//-----------------------------------------------------------------------------
+//   stemLengthInput
+///   Everything doCalcDefaultStemLength reads from the style, the chord, its notes and staff;
+///   none if the stem is beside a tab staff, that length is fixed anyway
+//-----------------------------------------------------------------------------
+std::optional<StemLengthInput> StemLayout::stemLengthInput(const Chord* item, const LayoutContext& ctx)
+{
+    const Chord::LayoutData* ldata = item->ldata();
+    const Staff* staff = item->staff();
+    const StaffType* staffType = staff ? staff->staffTypeForElement(item) : nullptr;
+    const StaffType* tab = (staffType && staffType->isTabStaff()) ? staffType : nullptr;
+    if (tab && !tab->stemless() && !tab->stemThrough()) {
+        return std::nullopt;
+    }
+
+    const Note* upNote = item->upNote();
+    const Note* downNote = item->downNote();
+    const Note* startNote = ldata->up ? downNote : upNote;
+    const TremoloTwoChord* trem = item->tremoloTwoChord();
+
+    return StemLengthInput {
+        static_cast<double>(ctx.conf().style().generation()),
+        static_cast<double>(item->durationType().type()),
+        item->spatium(),
+        staff ? staff->lineDistance(item->tick()) : 1.0,
+        static_cast<double>(staff ? staff->lines(item->tick()) : 5),
+        tab ? 1.0 : 0.0,
+        ldata->up ? 1.0 : 0.0,
+        static_cast<double>(item->upLine()),
+        static_cast<double>(item->downLine()),
+        static_cast<double>(upNote->line()),
+        static_cast<double>(downNote->line()),
+        ldata->up ? upNote->stemUpSE().y() : downNote->stemDownNW().y(),
+        item->intrinsicMag(),
+        (item->isGrace() || item->isSmall()) ? 1.0 : 0.0,
+        item->hook() ? 1.0 : 0.0,
+        item->beam() ? 1.0 : 0.0,
+        static_cast<double>(item->beams()),
+        trem ? 1.0 : 0.0,
+        static_cast<double>(trem ? trem->lines() : 0),
+        startNote->fixed() ? 1.0 : 0.0,
+        startNote->fixed() ? 0.0 : startNote->ldata()->pos().y()
+    };
+}
+
+double StemLayout::doCalcDefaultStemLength(Chord* item, const LayoutContext& ctx)
 {
     // returns default length even if the chord doesn't have a stem
     const MStyle& style = ctx.conf().style();
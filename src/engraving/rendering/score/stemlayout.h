@@ -22,8 +22,12 @@
 
 #pragma once
 
+#include <optional>
+
 #include "layoutcontext.h"
 
+#include "dom/chord.h"
+
 namespace mu::engraving {
 class Chord;
 class Stem;
@@ -80,6 +84,8 @@ public:
     static PointF tabStemPos(const Chord* item, const StaffType* st);
 
 private:
+    static double doCalcDefaultStemLength(Chord* item, const LayoutContext& ctx);
+    static std::optional<StemLengthInput> stemLengthInput(const Chord* item, const LayoutContext& ctx);
     static int stemLengthBeamAddition(const Chord* item, const LayoutContext& ctx);
     static int maxReduction(const Chord* item, const LayoutContext& ctx, int extensionOutsideStaff);
     static int stemOpticalAdjustment(const Chord* item, int stemEndPosition);
@@ -1292,104 +1292,116 @@ void SystemLayout::collectSpannersToLayout(ElementsToLayout& elements, const Lay
 void SystemLayout::createSkylines(const ElementsToLayout& elementsToLayout, LayoutContext& ctx)
 {
     System* system = elementsToLayout.system;
-    for (size_t staffIdx = 0; staffIdx < ctx.dom().nstaves(); ++staffIdx) {
-        SysStaff* ss = system->staff(staffIdx);
-        Skyline& skyline = ss->skyline();
-        skyline.clear();
-        for (Measure* m : elementsToLayout.measures) {
-            if (m->staffLines(staffIdx)->addToSkyline()) {
-                ss->skyline().add(m->staffLines(staffIdx)->ldata()->bbox().translated(m->pos()), m->staffLines(staffIdx));
-            }
-            for (Segment& s : m->segments()) {
-                if (!s.enabled()) {
-                    continue;
-                }
-                PointF p(s.pos() + m->pos());
-                if (s.isType(SegmentType::BarLineType)) {
+    const size_t nstaves = ctx.dom().nstaves();
+
+    for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+        system->staff(staffIdx)->skyline().clear();
+    }
+
+    //! NOTE Single pass over the segments, every element goes to the skyline of the staff it is displayed on
+    for (Measure* m : elementsToLayout.measures) {
+        for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
+            StaffLines* staffLines = m->staffLines(staffIdx);
+            if (staffLines->addToSkyline()) {
+                system->staff(staffIdx)->skyline().add(staffLines->ldata()->bbox().translated(m->pos()), staffLines);
+            }
+        }
+
+        for (Segment& s : m->segments()) {
+            if (!s.enabled()) {
+                continue;
+            }
+            PointF p(s.pos() + m->pos());
+            if (s.isType(SegmentType::BarLineType)) {
+                for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
                     BarLine* bl = toBarLine(s.element(staffIdx * VOICES));
                     if (bl && bl->addToSkyline()) {
-                        skyline.add(bl->shape().translated(bl->pos() + p + bl->staffOffset()));
+                        system->staff(staffIdx)->skyline().add(bl->shape().translated(bl->pos() + p + bl->staffOffset()));
                     }
-                } else if (s.isType(SegmentType::TimeSigType)) {
+                }
+            } else if (s.isType(SegmentType::TimeSigType)) {
+                for (staff_idx_t staffIdx = 0; staffIdx < nstaves; ++staffIdx) {
                     TimeSig* ts = toTimeSig(s.element(staffIdx * VOICES));
                     if (ts && ts->addToSkyline() && ts->showOnThisStaff()) {
                         TimeSigPlacement timeSigPlacement = ts->style().styleV(Sid::timeSigPlacement).value<TimeSigPlacement>();
                         if (timeSigPlacement != TimeSigPlacement::ACROSS_STAVES) {
-                            skyline.add(ts->shape().translate(ts->pos() + p + ts->staffOffset()));
+                            system->staff(staffIdx)->skyline().add(ts->shape().translate(ts->pos() + p + ts->staffOffset()));
                         }
                     }
-                } else {
-                    track_idx_t strack = staffIdx * VOICES;
-                    track_idx_t etrack = strack + VOICES;
-                    for (EngravingItem* e : s.elist()) {
-                        if (!e) {
-                            continue;
-                        }
-                        track_idx_t effectiveTrack = e->vStaffIdx() * VOICES + e->voice();
-                        if (effectiveTrack < strack || effectiveTrack >= etrack) {
-                            continue;
-                        }
-
-                        // add element to skyline
-                        if (e->addToSkyline()) {
-                            const PointF offset = e->staffOffset();
-                            skyline.add(e->shape().translate(e->pos() + p + offset));
-                            // add grace notes to skyline
-                            if (e->isChord()) {
-                                GraceNotesGroup& graceBefore = toChord(e)->graceNotesBefore();
-                                GraceNotesGroup& graceAfter = toChord(e)->graceNotesAfter();
-                                if (!graceBefore.empty()) {
-                                    skyline.add(graceBefore.shape().translate(graceBefore.pos() + p + offset));
-                                }
-                                if (!graceAfter.empty()) {
-                                    skyline.add(graceAfter.shape().translate(graceAfter.pos() + p + offset));
-                                }
-                            }
-                            // If present, add ornament cue note to skyline
-                            if (e->isChord()) {
-                                Ornament* ornament = toChord(e)->findOrnament();
-                                if (ornament) {
-                                    Chord* cue = ornament->cueNoteChord();
-                                    if (cue && cue->upNote()->visible()) {
-                                        skyline.add(cue->shape().translate(cue->pos() + p + cue->staffOffset()));
-                                    }
-                                }
-                            }
-                        }
+                }
+            } else {
+                for (EngravingItem* e : s.elist()) {
+                    if (!e) {
+                        continue;
+                    }
+                    staff_idx_t staffIdx = e->vStaffIdx();
+                    if (staffIdx >= nstaves) {
+                        continue;
+                    }
+                    addElementToSkyline(e, p, system->staff(staffIdx)->skyline());
+                }
+            }
+        }
+    }
+}
 
-                        // add tremolo to skyline
-                        if (e->isChord()) {
-                            Chord* ch = item_cast<Chord*>(e);
-                            if (ch->tremoloSingleChord()) {
-                                TremoloSingleChord* t = ch->tremoloSingleChord();
-                                if (t->addToSkyline()) {
-                                    skyline.add(t->shape().translate(t->pos() + e->pos() + p));
-                                }
-                            } else if (ch->tremoloTwoChord()) {
-                                TremoloTwoChord* t = ch->tremoloTwoChord();
-                                Chord* c1 = t->chord1();
-                                Chord* c2 = t->chord2();
-                                if (c1 && !c1->staffMove() && c2 && !c2->staffMove()) {
-                                    if (t->chord() == e && t->addToSkyline()) {
-                                        skyline.add(t->shape().translate(t->pos() + e->pos() + p));
-                                    }
-                                }
-                            }
-                        }
+void SystemLayout::addElementToSkyline(EngravingItem* e, const PointF& pos, Skyline& skyline)
+{
+    // add element to skyline
+    if (e->addToSkyline()) {
+        const PointF offset = e->staffOffset();
+        skyline.add(e->shape().translate(e->pos() + pos + offset));
+        // add grace notes to skyline
+        if (e->isChord()) {
+            GraceNotesGroup& graceBefore = toChord(e)->graceNotesBefore();
+            GraceNotesGroup& graceAfter = toChord(e)->graceNotesAfter();
+            if (!graceBefore.empty()) {
+                skyline.add(graceBefore.shape().translate(graceBefore.pos() + pos + offset));
+            }
+            if (!graceAfter.empty()) {
+                skyline.add(graceAfter.shape().translate(graceAfter.pos() + pos + offset));
+            }
+        }
+        // If present, add ornament cue note to skyline
+        if (e->isChord()) {
+            Ornament* ornament = toChord(e)->findOrnament();
+            if (ornament) {
+                Chord* cue = ornament->cueNoteChord();
+                if (cue && cue->upNote()->visible()) {
+                    skyline.add(cue->shape().translate(cue->pos() + pos + cue->staffOffset()));
+                }
+            }
+        }
+    }
 
-                        // add beams to skline
-                        if (e->isChordRest()) {
-                            ChordRest* cr = toChordRest(e);
-                            if (BeamLayout::isStartOfNonCrossBeam(cr)) {
-                                Beam* b = cr->beam();
-                                b->addSkyline(skyline);
-                            }
-                        }
-                    }
+    // add tremolo to skyline
+    if (e->isChord()) {
+        Chord* ch = item_cast<Chord*>(e);
+        if (ch->tremoloSingleChord()) {
+            TremoloSingleChord* t = ch->tremoloSingleChord();
+            if (t->addToSkyline()) {
+                skyline.add(t->shape().translate(t->pos() + e->pos() + pos));
+            }
+        } else if (ch->tremoloTwoChord()) {
+            TremoloTwoChord* t = ch->tremoloTwoChord();
+            Chord* c1 = t->chord1();
+            Chord* c2 = t->chord2();
+            if (c1 && !c1->staffMove() && c2 && !c2->staffMove()) {
+                if (t->chord() == e && t->addToSkyline()) {
+                    skyline.add(t->shape().translate(t->pos() + e->pos() + pos));
                 }
             }
         }
     }
+
+    // add beams to skline
+    if (e->isChordRest()) {
+        ChordRest* cr = toChordRest(e);
+        if (BeamLayout::isStartOfNonCrossBeam(cr)) {
+            Beam* b = cr->beam();
+            b->addSkyline(skyline);
+        }
+    }
 }
 
 void SystemLayout::doLayoutTies(System* system, const std::vector<Segment*>& sl, const Fraction& stick, const Fraction& etick,
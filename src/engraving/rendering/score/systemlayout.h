@@ -38,6 +38,7 @@ class System;
 class Measure;
 class Bracket;
 class BracketItem;
+class Skyline;
 class SkylineLine;
 }
 
@@ -150,6 +151,7 @@ private:
 
     static System* getNextSystem(LayoutContext& lc);
     static void createSkylines(const ElementsToLayout& elementsToLayout, LayoutContext& ctx);
+    static void addElementToSkyline(EngravingItem* e, const PointF& pos, Skyline& skyline);
     static void processLines(System* system, LayoutContext& ctx, const std::vector<Spanner*>& lines, bool align = false);
     static void layoutTies(Chord* ch, System* system, const Fraction& stick, LayoutContext& ctx);
     static void doLayoutTies(System* system, const std::vector<Segment*>& sl, const Fraction& stick, const Fraction& etick,
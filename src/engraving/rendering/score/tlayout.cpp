@@ -1219,7 +1219,7 @@ void TLayout::layoutBarLine2(BarLine* item, LayoutContext& ctx)
     ldata->setBbox(bbox);
 }
 
-void TLayout::layoutBeam(Beam* item, const LayoutContext& ctx)
+void TLayout::layoutBeam(Beam* item, LayoutContext& ctx)
 {
     LAYOUT_CALL_ITEM(item);
     BeamLayout::layout(item, ctx);
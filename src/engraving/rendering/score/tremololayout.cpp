@@ -38,7 +38,7 @@
 using namespace mu::engraving;
 using namespace mu::engraving::rendering::score;
 
-void TremoloLayout::layout(TremoloTwoChord* item, const LayoutContext& ctx)
+void TremoloLayout::layout(TremoloTwoChord* item, LayoutContext& ctx)
 {
     IF_ASSERT_FAILED(item->explicitParent()) {
         return;
@@ -209,7 +209,7 @@ void TremoloLayout::calcIsUp(TremoloTwoChord* item)
 //   layoutTwoNotesTremolo
 //---------------------------------------------------------
 
-void TremoloLayout::layoutTwoNotesTremolo(TremoloTwoChord* item, const LayoutContext& ctx, double x, double y, double h, double spatium)
+void TremoloLayout::layoutTwoNotesTremolo(TremoloTwoChord* item, LayoutContext& ctx, double x, double y, double h, double spatium)
 {
     UNUSED(x);
     UNUSED(y);
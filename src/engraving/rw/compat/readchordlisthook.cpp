@@ -44,7 +44,7 @@ void ReadChordListHook::read(XmlReader& e)
         return;
     }
 
-    m_score->chordList()->clear();
+    m_score->chordList()->clearDescriptions();
     m_score->chordList()->read(e, m_score->mscVersion());
     m_score->chordList()->setCustomChordList(true);
 
@@ -114,7 +114,7 @@ bool MscSaver::writeMscz(MasterScore* score, MscWriter& mscWriter, bool onlySele
     // Write ChordList
     {
         ChordList* chordList = score->chordList();
-        if (chordList->customChordList() && !chordList->empty()) {
+        if (chordList->customChordList() && !chordList->descriptions().empty()) {
             ByteArray chlData;
             Buffer chlBuf(&chlData);
             chlBuf.open(IODevice::WriteOnly);
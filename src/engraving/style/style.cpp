@@ -22,6 +22,8 @@
 
 #include "style.h"
 
+#include <atomic>
+
 #include "types/constants.h"
 #include "compat/pageformat.h"
 #include "rw/compat/readchordlisthook.h"
@@ -42,6 +44,8 @@ using namespace mu;
 using namespace muse::io;
 using namespace mu::engraving;
 
+static std::atomic<uint64_t> s_lastGeneration { 0 };
+
 const PropertyValue& MStyle::value(Sid idx) const
 {
     if (idx == Sid::NOSTYLE) {
@@ -74,6 +78,7 @@ void MStyle::set(const Sid t, const PropertyValue& val)
 
     const size_t idx = size_t(t);
     m_values[idx] = val;
+    m_generation = ++s_lastGeneration;
     if (t == Sid::spatium) {
         precomputeValues();
     } else {
@@ -70,6 +70,9 @@ public:
     void setSpatium(double v) { set(Sid::spatium, v); }
     double defaultSpatium() const;
 
+    //! NOTE Changes with every value set, styles with the same generation have the same values
+    uint64_t generation() const { return m_generation; }
+
     bool isDefault(Sid idx) const;
     void setDefaultStyleVersion(const int defaultsVersion);
     int defaultStyleVersion() const;
@@ -100,6 +103,7 @@ private:
 
     void readVersion(String versionTag);
     int m_version = 0;
+    uint64_t m_generation = 0;
 };
 } // namespace mu::engraving
 
@@ -27,11 +27,14 @@
 #include "dom/chordrest.h"
 #include "dom/masterscore.h"
 #include "dom/measure.h"
+#include "dom/mscore.h"
 #include "dom/note.h"
+#include "dom/stem.h"
 #include "dom/tremolotwochord.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
+#include "utils/testutils.h"
 
 using namespace mu;
 using namespace mu::engraving;
@@ -346,3 +349,91 @@ TEST_F(Engraving_BeamTests, drumKitBeam)
 
     MScore::useRead302InTestMode = useRead302;
 }
+
+//---------------------------------------------------------
+//   createBeamFiguresScore
+//    Score of repeated beam figures: an ostinato in the
+//    upper staff and an Alberti bass in the lower one
+//---------------------------------------------------------
+
+static MasterScore* createBeamFiguresScore(DurationType duration)
+{
+    static const std::vector<int> OSTINATO = { 76, 79, 84, 79, 74, 77, 83, 77, 72, 76, 79, 84 };
+    static const std::vector<int> ALBERTI = { 48, 55, 52, 55, 47, 55, 50, 55, 45, 52, 48, 52, 53, 60, 57, 60 };
+
+    return TestUtils::createNotesScore(2, 32, duration, { u"violin", u"violoncello" }, [](Chord* chord, int i) {
+        const std::vector<int>& figure = chord->staffIdx() == 0 ? OSTINATO : ALBERTI;
+        Note* note = chord->upNote();
+        note->setPitch(figure.at(i % figure.size()));
+        note->setTpcFromPitch();
+    });
+}
+
+struct BeamLayout {
+    PointF startAnchor;
+    PointF endAnchor;
+    std::vector<LineF> segments;
+    std::vector<double> stemLengths;
+};
+
+static std::vector<BeamLayout> layoutBeams(MasterScore* score)
+{
+    score->setLayoutAll();
+    score->doLayout();
+
+    std::vector<BeamLayout> beams;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->elist()) {
+            if (!e || !e->isChord()) {
+                continue;
+            }
+            const Beam* beam = toChord(e)->beam();
+            if (!beam || beam->elements().front() != e) {
+                continue;
+            }
+            BeamLayout layout;
+            layout.startAnchor = beam->ldata()->startAnchor;
+            layout.endAnchor = beam->ldata()->endAnchor;
+            for (const BeamSegment* segment : beam->beamSegments()) {
+                layout.segments.push_back(segment->line);
+            }
+            for (const ChordRest* cr : beam->elements()) {
+                if (cr->isChord() && toChord(cr)->stem()) {
+                    layout.stemLengths.push_back(toChord(cr)->stem()->length());
+                }
+            }
+            beams.push_back(layout);
+        }
+    }
+    return beams;
+}
+
+//---------------------------------------------------------
+//   beamPositionsCache
+//    Reused beam positions must give the same layout
+//    as the full search
+//---------------------------------------------------------
+
+TEST_F(Engraving_BeamTests, beamPositionsCache)
+{
+    for (DurationType duration : { DurationType::V_EIGHTH, DurationType::V_16TH }) {
+        MasterScore* score = createBeamFiguresScore(duration);
+        ASSERT_TRUE(score);
+
+        MScore::noLayoutCaches = true;
+        const std::vector<BeamLayout> expected = layoutBeams(score);
+        MScore::noLayoutCaches = false;
+        const std::vector<BeamLayout> actual = layoutBeams(score);
+
+        EXPECT_FALSE(expected.empty());
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i].startAnchor, expected[i].startAnchor) << "beam " << i;
+            EXPECT_EQ(actual[i].endAnchor, expected[i].endAnchor) << "beam " << i;
+            EXPECT_TRUE(actual[i].segments == expected[i].segments) << "beam " << i;
+            EXPECT_TRUE(actual[i].stemLengths == expected[i].stemLengths) << "beam " << i;
+        }
+
+        delete score;
+    }
+}
@@ -22,12 +22,17 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+
 #include "dom/bsp.h"
 #include "dom/page.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
@@ -86,3 +91,91 @@ TEST_F(Engraving_BspTreeTests, NearestNeighbor)
         EXPECT_EQ(nn, singleNote);
     }
 }
+
+/**
+ * @brief Engraving_BspTreeTests_PageHitShapes
+ * @details Check that the hit shapes cached by the page give the same answers as the items' own hit shapes
+ */
+TEST_F(Engraving_BspTreeTests, PageHitShapes)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    EXPECT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    EXPECT_TRUE(page);
+
+    // [GIVEN] A grid of positions covering the page
+    const RectF pageRect = page->pageBoundingRect();
+    const double step = pageRect.width() / 50;
+    const double width = step / 2;
+
+    for (double y = pageRect.top(); y < pageRect.bottom(); y += step) {
+        for (double x = pageRect.left(); x < pageRect.right(); x += step) {
+            PointF pos(x, y);
+            RectF hitRect(x - width, y - width, 3.0 * width, 3.0 * width);
+
+            // [WHEN] Testing the candidates from the bsp tree against the cached shapes
+            for (EngravingItem* item : page->items(hitRect)) {
+                // [THEN] The results match the uncached tests
+                EXPECT_EQ(page->hitShapeContains(item, pos), item->hitShapeContains(pos));
+                EXPECT_EQ(page->hitShapeIntersects(item, hitRect), item->hitShapeIntersects(hitRect));
+            }
+        }
+    }
+
+    // [WHEN] The page is invalidated
+    size_t revision = page->bspTreeRevision();
+    page->invalidateBspTree();
+    page->items(pageRect);
+
+    // [THEN] The cache is rebuilt
+    EXPECT_NE(revision, page->bspTreeRevision());
+
+    delete score;
+}
+
+/**
+ * @brief Engraving_BspTreeTests_DISABLED_HitTestBenchmark
+ * @details Simulates a mouse moving over a dense page, run with --gtest_also_run_disabled_tests
+ */
+TEST_F(Engraving_BspTreeTests, DISABLED_HitTestBenchmark)
+{
+    Score* score = ScoreRW::readScore(BSPTREE_DATA_DIR + u"nearest_neighbor.mscx");
+    EXPECT_TRUE(score);
+
+    Page* page = score->pages().at(0);
+    EXPECT_TRUE(page);
+
+    const RectF pageRect = page->pageBoundingRect();
+    const double width = 2.0;
+    const int MOVES = 100000;
+
+    std::vector<PointF> path;
+    path.reserve(MOVES);
+    for (int i = 0; i < MOVES; ++i) {
+        double t = double(i) / MOVES;
+        path.emplace_back(pageRect.left() + pageRect.width() * t, pageRect.top() + pageRect.height() * (0.5 + 0.4 * std::sin(t * 40)));
+    }
+
+    auto run = [&](bool cached) {
+        size_t hits = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (const PointF& pos : path) {
+            RectF hitRect(pos.x() - width, pos.y() - width, 3.0 * width, 3.0 * width);
+            for (EngravingItem* item : page->items(hitRect)) {
+                bool hit = cached ? page->hitShapeContains(item, pos) : item->hitShapeContains(pos);
+                hits += hit ? 1 : 0;
+            }
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        LOGI() << (cached ? "cached" : "uncached") << " hit shapes: " << MOVES << " moves, " << hits << " hits, "
+               << elapsed.count() << " ms";
+        return hits;
+    };
+
+    EXPECT_EQ(run(false), run(true));
+
+    delete score;
+}
@@ -22,6 +22,11 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
+#include "global/io/buffer.h"
+#include "global/io/file.h"
+
 #include "dom/chordrest.h"
 #include "dom/durationtype.h"
 #include "dom/excerpt.h"
@@ -34,6 +39,8 @@
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
@@ -423,3 +430,82 @@ TEST_F(Engraving_ChordSymbolTests, testNashvilleNumbers) {
 
     MScore::useRead302InTestMode = use302;
 }
+
+static muse::ByteArray chordListData(const ChordList* chordList)
+{
+    muse::io::Buffer buf;
+    buf.open(muse::io::IODevice::WriteOnly);
+    chordList->write(&buf);
+    return buf.data();
+}
+
+TEST_F(Engraving_ChordSymbolTests, testSharedChordList)
+{
+    // [GIVEN] Two scores using the same chord style
+    MasterScore* score1 = test_pre(u"extend");
+    MasterScore* score2 = test_pre(u"clear");
+
+    // [THEN] They got the same chord list, without a copy of its tables
+    EXPECT_EQ(chordListData(score1->chordList()), chordListData(score2->chordList()));
+    EXPECT_EQ(&score1->chordList()->descriptions(), &score2->chordList()->descriptions());
+
+    // [THEN] Which is the same as parsing the description file again
+    ChordList parsed;
+    parsed.configureAutoAdjust(score1->style().styleD(Sid::chordExtensionMag), score1->style().styleD(Sid::chordExtensionAdjust),
+                               score1->style().styleD(Sid::chordModifierMag), score1->style().styleD(Sid::chordModifierAdjust),
+                               score1->style().styleD(Sid::chordStackedModiferMag), score1->style().styleB(Sid::verticallyStackModifiers),
+                               score1->style().styleB(Sid::chordAlignmentExcludeModifiers), score1->style().styleSt(Sid::musicalTextFont));
+    auto parseFile = [&parsed, score1](const String& name) {
+        muse::io::File f(score1->configuration()->appDataPath() + "/styles/" + name);
+        EXPECT_TRUE(f.open(muse::io::IODevice::ReadOnly));
+        parsed.read(&f);
+    };
+    if (score1->style().styleB(Sid::chordsXmlFile)) {
+        parseFile(u"chords.xml");
+    }
+    parseFile(score1->style().styleSt(Sid::chordDescriptionFile));
+    EXPECT_EQ(chordListData(&parsed), chordListData(score1->chordList()));
+
+    // [WHEN] One of the scores customizes its list
+    const std::map<int, ChordDescription>* sharedDescriptions = &score2->chordList()->descriptions();
+    size_t descriptions = sharedDescriptions->size();
+    ChordDescription cd(u"custom");
+    score1->chordList()->insertDescription(cd);
+
+    // [THEN] It got its own copy and the other one is not affected
+    EXPECT_NE(&score1->chordList()->descriptions(), sharedDescriptions);
+    EXPECT_EQ(&score2->chordList()->descriptions(), sharedDescriptions);
+    EXPECT_EQ(score2->chordList()->descriptions().size(), descriptions);
+    EXPECT_NE(chordListData(score1->chordList()), chordListData(score2->chordList()));
+
+    delete score1;
+    delete score2;
+}
+
+//---------------------------------------------------------
+//   batch loading of lead sheets sharing a chord style,
+//   run with --gtest_also_run_disabled_tests
+//---------------------------------------------------------
+
+TEST_F(Engraving_ChordSymbolTests, DISABLED_testLoadLeadSheetsBenchmark)
+{
+    const std::vector<String> files = {
+        u"extend", u"clear", u"add-link", u"add-part", u"no-system", u"transpose", u"transpose-part",
+        u"realize", u"realize-concert-pitch", u"realize-override", u"realize-triplet",
+        u"realize-duration", u"realize-jazz"
+    };
+    const int ITERATIONS = 20;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < ITERATIONS; ++i) {
+        for (const String& file : files) {
+            MasterScore* score = ScoreRW::readScore(CHORDSYMBOL_DATA_DIR + file + u".mscx");
+            EXPECT_TRUE(score);
+            delete score;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LOGI() << "loaded " << ITERATIONS * files.size() << " lead sheets in " << elapsed.count() << " ms";
+}
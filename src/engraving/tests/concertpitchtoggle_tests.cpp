@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "dom/chord.h"
+#include "dom/factory.h"
+#include "dom/harmony.h"
+#include "dom/masterscore.h"
+#include "dom/segment.h"
+
+#include "utils/testutils.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_ConcertPitchToggleTests : public ::testing::Test
+{
+};
+
+static const std::vector<String> TRANSPOSING_INSTRUMENTS = {
+    u"bb-clarinet", u"horn", u"bb-trumpet", u"alto-saxophone"
+};
+
+//---------------------------------------------------------
+//   createTransposingScore
+//    Score of transposing instruments with a chord symbol
+//    on every other beat
+//---------------------------------------------------------
+
+static MasterScore* createTransposingScore(size_t staves, int measures)
+{
+    return TestUtils::createNotesScore(staves, measures, DurationType::V_QUARTER, TRANSPOSING_INSTRUMENTS, [](Chord* chord, int i) {
+        if (i % 2) {
+            return;
+        }
+        Segment* segment = chord->segment();
+        Harmony* harmony = Factory::createHarmony(segment);
+        harmony->setTrack(chord->track());
+        harmony->setParent(segment);
+        harmony->setHarmony(u"D7");
+        segment->add(harmony);
+    });
+}
+
+static Harmony* firstHarmony(Score* score, staff_idx_t staffIdx)
+{
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->annotations()) {
+            if (e->isHarmony() && e->staffIdx() == staffIdx) {
+                return toHarmony(e);
+            }
+        }
+    }
+    return nullptr;
+}
+
+TEST_F(Engraving_ConcertPitchToggleTests, concertPitchTransposesHarmonies)
+{
+    MasterScore* score = createTransposingScore(TRANSPOSING_INSTRUMENTS.size(), 2);
+    ASSERT_TRUE(score);
+
+    std::vector<String> writtenNames;
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        Harmony* harmony = firstHarmony(score, staffIdx);
+        ASSERT_TRUE(harmony);
+        writtenNames.push_back(harmony->harmonyName());
+    }
+
+    score->startCmd(TranslatableString::untranslatable("Concert pitch tests"));
+    score->cmdConcertPitchChanged(true);
+    score->endCmd();
+
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        // all instruments here transpose, so every chord symbol changes
+        EXPECT_NE(firstHarmony(score, staffIdx)->harmonyName(), writtenNames.at(staffIdx));
+    }
+
+    score->startCmd(TranslatableString::untranslatable("Concert pitch tests"));
+    score->cmdConcertPitchChanged(false);
+    score->endCmd();
+
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        EXPECT_EQ(firstHarmony(score, staffIdx)->harmonyName(), writtenNames.at(staffIdx));
+    }
+
+    // the chord symbols of a staff are transposed by a single command, undo it
+    score->undoRedo(true, nullptr);
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        EXPECT_NE(firstHarmony(score, staffIdx)->harmonyName(), writtenNames.at(staffIdx));
+    }
+
+    score->undoRedo(true, nullptr);
+    for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+        EXPECT_EQ(firstHarmony(score, staffIdx)->harmonyName(), writtenNames.at(staffIdx));
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_ConcertPitchToggleTests, DISABLED_benchmark)
+{
+    MasterScore* score = createTransposingScore(32, 200);
+    ASSERT_TRUE(score);
+
+    auto duration = TestUtils::averageDuration(5, [score](int) {
+        // switch to concert pitch
+        score->startCmd(TranslatableString::untranslatable("Concert pitch benchmark"));
+        score->cmdConcertPitchChanged(true);
+        score->endCmd();
+
+        // switch back
+        score->startCmd(TranslatableString::untranslatable("Concert pitch benchmark"));
+        score->cmdConcertPitchChanged(false);
+        score->endCmd();
+    });
+
+    LOGI() << "concert pitch toggle in " << score->nstaves() << " staves: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() / 2 << " ms";
+
+    delete score;
+}
@@ -22,17 +22,25 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
+#include "dom/accidental.h"
+#include "dom/chord.h"
+#include "dom/factory.h"
 #include "dom/lyrics.h"
 #include "dom/masterscore.h"
 #include "dom/measure.h"
+#include "dom/mscore.h"
 #include "dom/page.h"
 #include "dom/rest.h"
+#include "dom/segment.h"
 #include "dom/staff.h"
 #include "dom/system.h"
 #include "dom/tuplet.h"
 #include "dom/note.h"
 
 #include "utils/scorerw.h"
+#include "utils/testutils.h"
 
 #include "log.h"
 
@@ -164,3 +172,254 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+TEST_F(Engraving_LayoutElementsTests, DISABLED_benchmarkOrchestralLayout)
+{
+    MasterScore* score = TestUtils::createNotesScore(40, 100, DurationType::V_QUARTER, { u"voice" });
+    ASSERT_TRUE(score);
+    EXPECT_FALSE(score->systems().empty());
+
+    auto duration = TestUtils::averageDuration(10, [score](int) {
+        score->doLayout();
+    });
+
+    LOGI() << "layout of " << score->nstaves() << " staves, " << score->systems().size() << " systems: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
+
+TEST_F(Engraving_LayoutElementsTests, DISABLED_benchmarkKeystrokeLayout)
+{
+    MasterScore* score = TestUtils::createNotesScore(40, 100, DurationType::V_QUARTER, { u"voice" });
+    ASSERT_TRUE(score);
+
+    // a note in the middle of a wide system
+    Measure* measure = score->tick2measure(Fraction(50, 1));
+    ASSERT_TRUE(measure);
+    Segment* segment = measure->first(SegmentType::ChordRest);
+    ASSERT_TRUE(segment);
+    Chord* chord = toChord(segment->element(20 * VOICES));
+    ASSERT_TRUE(chord);
+
+    for (bool noLayoutCaches : { true, false }) {
+        MScore::noLayoutCaches = noLayoutCaches;
+        auto duration = TestUtils::averageDuration(50, [score, chord](int i) {
+            score->select(chord->upNote());
+            score->startCmd(TranslatableString::untranslatable("Keystroke layout benchmark"));
+            score->upDown(i % 2 == 0, UpDownMode::CHROMATIC);
+            score->endCmd();
+        });
+
+        LOGI() << "layout per keystroke in " << score->nstaves() << " staves, " << (noLayoutCaches ? "without" : "with")
+               << " layout caches: " << duration.count() << " us";
+    }
+
+    MScore::noLayoutCaches = false;
+    delete score;
+}
+
+//---------------------------------------------------------
+//   createHymnalScore
+//    Vocal score with several verses of hyphenated lyrics,
+//    interrupted by instrumental interludes
+//---------------------------------------------------------
+
+static MasterScore* createHymnalScore(size_t staves, int verses, int measures)
+{
+    constexpr int SUNG_MEASURES = 16;
+    constexpr int INTERLUDE_MEASURES = 8;
+
+    return TestUtils::createNotesScore(staves, measures, DurationType::V_QUARTER, { u"voice" }, [verses](Chord* chord, int i) {
+        if ((i / 4) % (SUNG_MEASURES + INTERLUDE_MEASURES) >= SUNG_MEASURES) {
+            return;
+        }
+        for (int verse = 0; verse < verses; ++verse) {
+            Lyrics* lyrics = Factory::createLyrics(chord);
+            lyrics->setTrack(chord->track());
+            lyrics->setNo(verse);
+            lyrics->setPlainText(u"la");
+            lyrics->setSyllabic(i % 2 ? LyricsSyllabic::END : LyricsSyllabic::BEGIN);
+            chord->add(lyrics);
+        }
+    });
+}
+
+TEST_F(Engraving_LayoutElementsTests, DISABLED_benchmarkHymnalLayout)
+{
+    MasterScore* score = createHymnalScore(4, 6, 400);
+    ASSERT_TRUE(score);
+    EXPECT_FALSE(score->systems().empty());
+
+    auto duration = TestUtils::averageDuration(10, [score](int) {
+        score->doLayout();
+    });
+
+    LOGI() << "layout of " << score->nmeasures() << " measures with lyrics, " << score->systems().size() << " systems: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
+
+TEST_F(Engraving_LayoutElementsTests, DISABLED_benchmarkChoralLayout)
+{
+    MasterScore* score = createHymnalScore(32, 3, 100);
+    ASSERT_TRUE(score);
+    EXPECT_FALSE(score->systems().empty());
+
+    auto duration = TestUtils::averageDuration(10, [score](int) {
+        score->doLayout();
+    });
+
+    LOGI() << "layout of " << score->nstaves() << " staves with lyrics, " << score->systems().size() << " systems: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   createClustersScore
+//    Score of dense chromatic chords, the same clusters
+//    come back on every degree of the scale
+//---------------------------------------------------------
+
+static MasterScore* createClustersScore(size_t staves, int measures)
+{
+    static const std::vector<std::vector<int> > CLUSTERS = {
+        { 1, 3, 6 }, { 1, 2, 4, 11 }, { 3, 4, 8, 13 }, { 1, 6, 7, 12, 13 }, { 2, 3, 5, 10, 14, 15 }
+    };
+
+    return TestUtils::createNotesScore(staves, measures, DurationType::V_QUARTER, { u"piano" }, [](Chord* chord, int i) {
+        const int root = chord->upNote()->pitch();
+        for (int interval : CLUSTERS.at(i % CLUSTERS.size())) {
+            Note* note = Factory::createNote(chord);
+            chord->add(note);
+            note->setPitch(root + interval);
+            note->setTpcFromPitch(i % 2 ? Prefer::FLATS : Prefer::SHARPS);
+        }
+    });
+}
+
+static std::vector<std::pair<PointF, int> > layoutAccidentals(MasterScore* score)
+{
+    score->setLayoutAll();
+    score->doLayout();
+
+    std::vector<std::pair<PointF, int> > accidentals;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->elist()) {
+            if (!e || !e->isChord()) {
+                continue;
+            }
+            for (const Note* note : toChord(e)->notes()) {
+                if (const Accidental* acc = note->accidental()) {
+                    accidentals.emplace_back(acc->ldata()->pos(), acc->ldata()->column.value());
+                }
+            }
+        }
+    }
+    return accidentals;
+}
+
+//---------------------------------------------------------
+//   tstAccidentalsPlacementCache
+//    Reused accidental placements must give the same
+//    positions as the full placement
+//---------------------------------------------------------
+
+TEST_F(Engraving_LayoutElementsTests, tstAccidentalsPlacementCache)
+{
+    MasterScore* score = createClustersScore(2, 16);
+    ASSERT_TRUE(score);
+
+    MScore::noLayoutCaches = true;
+    const std::vector<std::pair<PointF, int> > expected = layoutAccidentals(score);
+    MScore::noLayoutCaches = false;
+    const std::vector<std::pair<PointF, int> > actual = layoutAccidentals(score);
+
+    EXPECT_FALSE(expected.empty());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(actual[i].first, expected[i].first) << "accidental " << i;
+        EXPECT_EQ(actual[i].second, expected[i].second) << "accidental " << i;
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_LayoutElementsTests, DISABLED_benchmarkAccidentalsLayout)
+{
+    MasterScore* score = createClustersScore(8, 100);
+    ASSERT_TRUE(score);
+
+    for (bool noLayoutCaches : { true, false }) {
+        MScore::noLayoutCaches = noLayoutCaches;
+        auto duration = TestUtils::averageDuration(10, [score](int) {
+            score->setLayoutAll();
+            score->doLayout();
+        });
+
+        LOGI() << "layout of " << score->nstaves() << " staves of clusters, " << (noLayoutCaches ? "without" : "with")
+               << " layout caches: " << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+    }
+
+    MScore::noLayoutCaches = false;
+    delete score;
+}
+
+static std::vector<double> layoutStemLengths(MasterScore* score)
+{
+    score->setLayoutAll();
+    score->doLayout();
+
+    std::vector<double> stemLengths;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->elist()) {
+            if (e && e->isChord()) {
+                stemLengths.push_back(toChord(e)->defaultStemLength());
+            }
+        }
+    }
+    return stemLengths;
+}
+
+//---------------------------------------------------------
+//   tstStemLengthCache
+//    Stem lengths kept from the previous layout must follow
+//    note and style changes like calculated ones
+//---------------------------------------------------------
+
+TEST_F(Engraving_LayoutElementsTests, tstStemLengthCache)
+{
+    MasterScore* score = createClustersScore(2, 16);
+    ASSERT_TRUE(score);
+
+    auto expectCachedLengths = [score]() {
+        MScore::noLayoutCaches = true;
+        const std::vector<double> expected = layoutStemLengths(score);
+        MScore::noLayoutCaches = false;
+        const std::vector<double> actual = layoutStemLengths(score);
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(actual, expected);
+    };
+
+    // the first layout with caches fills them, the second one reuses them
+    layoutStemLengths(score);
+    expectCachedLengths();
+
+    Chord* chord = toChord(score->firstSegment(SegmentType::ChordRest)->element(0));
+    ASSERT_TRUE(chord);
+    score->select(chord->upNote());
+    score->startCmd(TranslatableString::untranslatable("Stem length cache test"));
+    score->upDown(true, UpDownMode::OCTAVE);
+    score->endCmd();
+    expectCachedLengths();
+
+    score->startCmd(TranslatableString::untranslatable("Stem length cache test"));
+    score->undoChangeStyleVal(Sid::stemLength, 4.0);
+    score->endCmd();
+    expectCachedLengths();
+
+    delete score;
+}
@@ -22,19 +22,31 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <tuple>
+
 #include "dom/engravingitem.h"
 #include "dom/excerpt.h"
+#include "dom/factory.h"
+#include "dom/fermata.h"
+#include "dom/gradualtempochange.h"
 #include "dom/masterscore.h"
 #include "dom/measure.h"
 #include "dom/measurenumber.h"
+#include "dom/noteval.h"
 #include "dom/rest.h"
 #include "dom/segment.h"
+#include "dom/sig.h"
+#include "dom/tempo.h"
+#include "dom/tempotext.h"
 #include "dom/undo.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 #include "utils/testutils.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
@@ -690,3 +702,191 @@ TEST_F(Engraving_MeasureTests, MMRestContinuationCourtesies) {
 
     MScore::useRead302InTestMode = use302;
 }
+
+TEST_F(Engraving_MeasureTests, insertMeasureNearEndUpdatesMaps)
+{
+    MasterScore* score = TestUtils::createNotesScore(1, 100);
+    ASSERT_TRUE(score);
+
+    auto insertMeasureBeforeLast = [score]() {
+        Measure* m = score->lastMeasure()->prevMeasure();
+        score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+        score->insertMeasure(m);
+        score->endCmd();
+
+        // the maps are rebuilt from the inserted measure only, compare with a full rebuild
+        const std::map<int, TEvent> tempoEvents = *score->tempomap();
+        const std::map<int, SigEvent> sigEvents = *score->sigmap();
+        score->setUpTempoMap();
+        EXPECT_TRUE(tempoEvents == *score->tempomap());
+        EXPECT_TRUE(sigEvents == *score->sigmap());
+    };
+
+    insertMeasureBeforeLast();
+
+    EXPECT_EQ(score->nmeasures(), 101u);
+    EXPECT_EQ(score->lastMeasure()->tick(), Fraction(100, 1));
+
+    // a rit. that ends before the rebuilt measures, followed by "a tempo" and a fermata:
+    // both have to see the tempo before the rit., not its last point
+    score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+
+    Segment* tempoSegment = score->tick2segment(Fraction(80, 1), true, SegmentType::ChordRest);
+    TempoText* tempo = Factory::createTempoText(tempoSegment);
+    tempo->setParent(tempoSegment);
+    tempo->setTrack(0);
+    tempo->setXmlText(u"Allegro");
+    tempo->setTempo(2.5);
+    tempo->setFollowText(false);
+    score->undoAddElement(tempo);
+
+    GradualTempoChange* rit = Factory::createGradualTempoChange(score->dummy());
+    rit->setTempoChangeType(GradualTempoChangeType::Ritardando);
+    rit->setTick(Fraction(85, 1));
+    rit->setTick2(Fraction(90, 1));
+    rit->setTrack(0);
+    rit->setTrack2(0);
+    score->undoAddElement(rit);
+
+    Segment* aTempoSegment = score->tick2segment(Fraction(98, 1), true, SegmentType::ChordRest);
+    TempoText* aTempo = Factory::createTempoText(aTempoSegment);
+    aTempo->setParent(aTempoSegment);
+    aTempo->setTrack(0);
+    aTempo->setXmlText(u"a tempo");
+    aTempo->setATempo();
+    aTempo->setFollowText(true);
+    score->undoAddElement(aTempo);
+
+    Segment* fermataSegment = score->tick2segment(Fraction(99, 1) + Fraction(1, 4), true, SegmentType::ChordRest);
+    Fermata* fermata = Factory::createFermata(fermataSegment);
+    fermata->setParent(fermataSegment);
+    fermata->setTrack(0);
+    fermata->setTimeStretch(2.0);
+    score->undoAddElement(fermata);
+
+    score->endCmd();
+
+    insertMeasureBeforeLast();
+
+    EXPECT_EQ(score->nmeasures(), 102u);
+    EXPECT_EQ(score->tempomap()->tempo(Fraction(98, 1).ticks()), BeatsPerSecond(2.5));
+
+    delete score;
+}
+
+TEST_F(Engraving_MeasureTests, DISABLED_benchmarkInsertMeasureNearEnd)
+{
+    MasterScore* score = TestUtils::createNotesScore(1, 1000);
+    ASSERT_TRUE(score);
+
+    constexpr int ITERATIONS = 10;
+    std::chrono::steady_clock::duration total { 0 };
+    for (int i = 0; i < ITERATIONS; ++i) {
+        Measure* m = score->lastMeasure()->prevMeasure();
+        score->startCmd(TranslatableString::untranslatable("Engraving measure benchmark"));
+        auto start = std::chrono::steady_clock::now();
+        score->insertMeasure(m);
+        total += std::chrono::steady_clock::now() - start;
+        score->endCmd();
+    }
+
+    LOGI() << "insert measure near the end of " << score->nmeasures() << " measures: "
+           << std::chrono::duration_cast<std::chrono::microseconds>(total).count() / ITERATIONS << " us";
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   createPartWithRests
+//    one staff of measure rests with a note in every tenth
+//    and in the last measure, laid out with multi measure rests
+//---------------------------------------------------------
+
+static MasterScore* createPartWithRests(int measures)
+{
+    MasterScore* score = TestUtils::createNotesScore(1, measures, DurationType::V_WHOLE);
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (m->no() % 10 == 0 || !m->nextMeasure()) {
+            continue;
+        }
+        Segment* s = m->first(SegmentType::ChordRest);
+        EngravingItem* chord = s->element(0);
+        s->remove(chord);
+        delete chord;
+
+        Rest* rest = Factory::createRest(s, TDuration(DurationType::V_MEASURE));
+        rest->setTicks(m->ticks());
+        rest->setTrack(0);
+        s->add(rest);
+    }
+
+    score->style().set(Sid::createMultiMeasureRests, true);
+    score->doLayout();
+    return score;
+}
+
+// first measure number, measure count and length of each multi measure rest
+static std::vector<std::tuple<int, int, Fraction> > mmRestRuns(Score* score)
+{
+    std::vector<std::tuple<int, int, Fraction> > runs;
+    for (Measure* m = score->firstMeasureMM(); m; m = m->nextMeasureMM()) {
+        EXPECT_TRUE(m->system());
+        if (m->isMMRest()) {
+            runs.emplace_back(m->no(), m->mmRestCount(), m->ticks());
+        }
+    }
+    return runs;
+}
+
+static void addWholeNote(Score* score, int measureIdx)
+{
+    Measure* m = score->tick2measure(Fraction(measureIdx, 1));
+    score->startCmd(TranslatableString::untranslatable("Engraving measure tests"));
+    score->setNoteRest(m->first(SegmentType::ChordRest), 0, NoteVal(74), m->ticks());
+    score->endCmd();
+}
+
+TEST_F(Engraving_MeasureTests, mmRestsKeptOutsideEdit)
+{
+    MasterScore* score = createPartWithRests(200);
+    ASSERT_TRUE(score);
+
+    const auto initialRuns = mmRestRuns(score);
+    EXPECT_EQ(initialRuns.size(), 20u);
+
+    // split the run of measures 21-29, the runs around it are reused
+    addWholeNote(score, 25);
+    const auto runs = mmRestRuns(score);
+    EXPECT_EQ(runs.size(), 21u);
+
+    score->doLayout();
+    EXPECT_EQ(runs, mmRestRuns(score));
+
+    // join it again
+    score->undoRedo(true, nullptr);
+    EXPECT_EQ(mmRestRuns(score), initialRuns);
+
+    score->doLayout();
+    EXPECT_EQ(mmRestRuns(score), initialRuns);
+
+    delete score;
+}
+
+TEST_F(Engraving_MeasureTests, DISABLED_benchmarkEditWithMMRests)
+{
+    MasterScore* score = createPartWithRests(2000);
+    ASSERT_TRUE(score);
+
+    constexpr int ITERATIONS = 10;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        addWholeNote(score, 5);
+        score->undoRedo(true, nullptr);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    LOGI() << "edit in a part with " << mmRestRuns(score).size() << " multi measure rests: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() / (2 * ITERATIONS) << " ms";
+
+    delete score;
+}
@@ -22,11 +22,17 @@
 
 #include <gtest/gtest.h>
 
+#include "dom/chord.h"
+#include "dom/factory.h"
 #include "dom/masterscore.h"
 #include "dom/measure.h"
+#include "dom/note.h"
 #include "dom/repeatlist.h"
+#include "dom/segment.h"
+#include "dom/tempotext.h"
 
 #include "utils/scorerw.h"
+#include "utils/testutils.h"
 
 #include "log.h"
 
@@ -422,3 +428,90 @@ TEST_F(Engraving_RepeatTests, repeat68) {
 TEST_F(Engraving_RepeatTests, repeat69) {
     repeat("repeat69.mscx", u"1; 2;3; 2;3; 4");
 }
+
+//---------------------------------------------------------
+//   createRepeatScore
+//    8 measures, measures 3-4 repeated
+//---------------------------------------------------------
+
+static MasterScore* createRepeatScore()
+{
+    MasterScore* score = TestUtils::createNotesScore(1, 8);
+    TestUtils::addRepeat(score, 2, 3);
+    score->setExpandRepeats(true);
+    score->doLayout();
+    return score;
+}
+
+//---------------------------------------------------------
+//   expectSameAsFullUnwind
+//    the (possibly reused) repeat list of the score should
+//    match one computed from scratch
+//---------------------------------------------------------
+
+static void expectSameAsFullUnwind(MasterScore* score)
+{
+    const RepeatList& repeatList = score->repeatList();
+
+    RepeatList reference(score);
+    reference.update(true, false);
+
+    ASSERT_EQ(repeatList.size(), reference.size());
+    for (size_t i = 0; i < reference.size(); ++i) {
+        const RepeatSegment* rs = repeatList.at(i);
+        const RepeatSegment* ref = reference.at(i);
+        EXPECT_EQ(rs->tick, ref->tick);
+        EXPECT_EQ(rs->len(), ref->len());
+        EXPECT_EQ(rs->utick, ref->utick);
+        EXPECT_DOUBLE_EQ(rs->utime, ref->utime);
+        EXPECT_DOUBLE_EQ(rs->timeOffset, ref->timeOffset);
+        EXPECT_DOUBLE_EQ(rs->pause, ref->pause);
+        EXPECT_EQ(rs->playbackCount, ref->playbackCount);
+        EXPECT_EQ(rs->measureList(), ref->measureList());
+    }
+    EXPECT_EQ(repeatList.ticks(), reference.ticks());
+}
+
+TEST_F(Engraving_RepeatTests, reusedUnwindMatchesFullRecompute)
+{
+    MasterScore* score = createRepeatScore();
+    ASSERT_TRUE(score);
+    expectSameAsFullUnwind(score);
+    EXPECT_EQ(score->repeatList().ticks(), 10 * 4 * Constants::DIVISION);
+
+    // non-structural: pitch change
+    Segment* segment = score->firstSegment(SegmentType::ChordRest);
+    Note* note = toChord(segment->element(0))->upNote();
+    score->startCmd(TranslatableString::untranslatable("Repeat list tests"));
+    note->undoChangeProperty(Pid::PITCH, note->pitch() + 2);
+    score->endCmd();
+    expectSameAsFullUnwind(score);
+
+    // non-structural, but changes the timing: tempo text
+    Segment* tempoSegment = score->firstMeasure()->nextMeasure()->first(SegmentType::ChordRest);
+    TempoText* tempo = Factory::createTempoText(tempoSegment);
+    tempo->setParent(tempoSegment);
+    tempo->setTrack(0);
+    tempo->setXmlText(u"Allegro");
+    tempo->setTempo(2.5);
+    tempo->setFollowText(false);
+    score->startCmd(TranslatableString::untranslatable("Repeat list tests"));
+    score->undoAddElement(tempo);
+    score->endCmd();
+    expectSameAsFullUnwind(score);
+
+    // structural: remove the end repeat
+    Measure* m4 = score->firstMeasure()->nextMeasure()->nextMeasure()->nextMeasure();
+    score->startCmd(TranslatableString::untranslatable("Repeat list tests"));
+    m4->undoChangeProperty(Pid::REPEAT_END, false);
+    score->endCmd();
+    expectSameAsFullUnwind(score);
+    EXPECT_EQ(score->repeatList().ticks(), 8 * 4 * Constants::DIVISION);
+
+    // structural: undo brings the repeat back
+    score->undoRedo(true, nullptr);
+    expectSameAsFullUnwind(score);
+    EXPECT_EQ(score->repeatList().ticks(), 10 * 4 * Constants::DIVISION);
+
+    delete score;
+}
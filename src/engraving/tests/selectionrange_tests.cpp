@@ -22,6 +22,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "dom/chord.h"
 #include "dom/masterscore.h"
 #include "dom/measure.h"
@@ -30,6 +32,9 @@
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
+#include "utils/testutils.h"
+
+#include "log.h"
 
 using namespace mu;
 using namespace mu::engraving;
@@ -328,3 +333,20 @@ TEST_F(Engraving_SelectionRangeTests, deletePartialNestedTuplets)
     EXPECT_TRUE(ScoreComp::saveCompareScore(score, String(u"selectionrangedelete06_partialnestedtuplets.mscx"),
                                             SELRANGE_DATA_DIR + String(u"selectionrangedelete06_partialnestedtuplets-ref.mscx")));
 }
+
+TEST_F(Engraving_SelectionRangeTests, DISABLED_benchmarkSelectAll)
+{
+    // orchestral sized score: 32 staves of 500 measures
+    MasterScore* score = TestUtils::createNotesScore(32, 500, DurationType::V_EIGHTH, { u"violin" });
+
+    auto duration = TestUtils::averageDuration(5, [score](int) {
+        score->deselectAll();
+        score->cmdSelectAll();
+    });
+
+    EXPECT_TRUE(score->selection().isRange());
+    LOGI() << "select all of " << score->selection().elements().size() << " elements: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
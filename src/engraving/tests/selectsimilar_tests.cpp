@@ -0,0 +1,244 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-Studio-CLA-applies
+ *
+ * MuseScore Studio
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore Limited
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <set>
+
+#include "dom/chord.h"
+#include "dom/dynamic.h"
+#include "dom/factory.h"
+#include "dom/masterscore.h"
+#include "dom/note.h"
+#include "dom/segment.h"
+
+#include "utils/testutils.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_SelectSimilarTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   addDynamics
+//    a dynamic at the start of every measure of every staff
+//---------------------------------------------------------
+
+static void addDynamics(MasterScore* score)
+{
+    score->startCmd(TranslatableString::untranslatable("Select similar tests"));
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        Segment* segment = m->first(SegmentType::ChordRest);
+        for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            Dynamic* dynamic = Factory::createDynamic(segment);
+            dynamic->setDynamicType(DynamicType::MF);
+            dynamic->setTrack(staff2track(staffIdx));
+            dynamic->setParent(segment);
+            score->undoAddElement(dynamic);
+        }
+    }
+    score->endCmd();
+}
+
+static std::vector<EngravingItem*> scannedItems(Score* score, ElementType type)
+{
+    struct Collect {
+        ElementType type;
+        std::vector<EngravingItem*> items;
+    };
+
+    Collect collect { type, {} };
+    score->scanElements(&collect, [](void* data, EngravingItem* item) {
+        Collect* c = static_cast<Collect*>(data);
+        if (item->type() == c->type) {
+            c->items.push_back(item);
+        }
+    });
+    return collect.items;
+}
+
+static std::vector<EngravingItem*> indexedItems(Score* score, ElementType type)
+{
+    std::vector<EngravingItem*> items;
+    score->scanElementsOfType(type, &items, [](void* data, EngravingItem* item) {
+        static_cast<std::vector<EngravingItem*>*>(data)->push_back(item);
+    });
+    return items;
+}
+
+static Dynamic* firstDynamic(Score* score)
+{
+    for (EngravingItem* e : score->firstSegment(SegmentType::ChordRest)->annotations()) {
+        if (e->isDynamic()) {
+            return toDynamic(e);
+        }
+    }
+    return nullptr;
+}
+
+static Note* firstNote(Score* score)
+{
+    Segment* segment = score->firstSegment(SegmentType::ChordRest);
+    return toChord(segment->element(0))->upNote();
+}
+
+TEST_F(Engraving_SelectSimilarTests, selectSimilarNotes)
+{
+    MasterScore* score = TestUtils::createNotesScore(2, 4);
+    ASSERT_TRUE(score);
+
+    score->selectSimilar(firstNote(score), false);
+
+    const std::vector<EngravingItem*>& selected = score->selection().elements();
+    EXPECT_TRUE(score->selection().isList());
+    EXPECT_EQ(selected.size(), 2u * 4 * 4);
+    EXPECT_EQ(std::set<EngravingItem*>(selected.begin(), selected.end()).size(), selected.size());
+    for (EngravingItem* e : selected) {
+        EXPECT_TRUE(e->isNote());
+        EXPECT_TRUE(e->selected());
+    }
+
+    score->selectSimilar(firstNote(score), true);
+    EXPECT_EQ(score->selection().elements().size(), 4u * 4);
+
+    delete score;
+}
+
+TEST_F(Engraving_SelectSimilarTests, selectAddSkipsSelected)
+{
+    MasterScore* score = TestUtils::createNotesScore(1, 1);
+    ASSERT_TRUE(score);
+
+    std::vector<EngravingItem*> notes;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        notes.push_back(toChord(s->element(0))->upNote());
+    }
+    ASSERT_EQ(notes.size(), 4u);
+
+    score->select(notes.front(), SelectType::SINGLE);
+    // already selected and repeated items are added only once
+    score->select({ notes.at(0), notes.at(1), notes.at(1), notes.at(2), notes.at(3) }, SelectType::ADD);
+
+    EXPECT_EQ(score->selection().elements(), notes);
+
+    delete score;
+}
+
+TEST_F(Engraving_SelectSimilarTests, indexedTypesMatchScan)
+{
+    MasterScore* score = TestUtils::createNotesScore(2, 8, DurationType::V_EIGHTH);
+    ASSERT_TRUE(score);
+    addDynamics(score);
+
+    std::vector<EngravingItem*> dynamics = indexedItems(score, ElementType::DYNAMIC);
+    EXPECT_EQ(dynamics.size(), 2u * 8);
+    EXPECT_EQ(dynamics, scannedItems(score, ElementType::DYNAMIC));
+
+    std::vector<EngravingItem*> beams = indexedItems(score, ElementType::BEAM);
+    EXPECT_FALSE(beams.empty());
+    EXPECT_EQ(beams, scannedItems(score, ElementType::BEAM));
+
+    // removed items are kept alive by the undo stack, but are no longer in the score
+    Dynamic* removed = firstDynamic(score);
+    ASSERT_TRUE(removed);
+    score->startCmd(TranslatableString::untranslatable("Select similar tests"));
+    score->undoRemoveElement(removed);
+    score->endCmd();
+
+    dynamics = indexedItems(score, ElementType::DYNAMIC);
+    EXPECT_EQ(dynamics.size(), 2u * 8 - 1);
+    EXPECT_FALSE(muse::contains(dynamics, static_cast<EngravingItem*>(removed)));
+    EXPECT_EQ(dynamics, scannedItems(score, ElementType::DYNAMIC));
+
+    // the same for removed measures
+    score->startCmd(TranslatableString::untranslatable("Select similar tests"));
+    score->deleteMeasures(score->firstMeasure()->nextMeasure(), score->firstMeasure()->nextMeasure());
+    score->endCmd();
+    EXPECT_EQ(indexedItems(score, ElementType::DYNAMIC), scannedItems(score, ElementType::DYNAMIC));
+    EXPECT_EQ(indexedItems(score, ElementType::BEAM), scannedItems(score, ElementType::BEAM));
+
+    score->undoRedo(true, nullptr);
+    score->undoRedo(true, nullptr);
+    EXPECT_EQ(indexedItems(score, ElementType::DYNAMIC).size(), 2u * 8);
+    EXPECT_EQ(indexedItems(score, ElementType::DYNAMIC), scannedItems(score, ElementType::DYNAMIC));
+
+    delete score;
+}
+
+TEST_F(Engraving_SelectSimilarTests, selectSimilarDynamics)
+{
+    MasterScore* score = TestUtils::createNotesScore(2, 4);
+    ASSERT_TRUE(score);
+    addDynamics(score);
+
+    score->selectSimilar(firstDynamic(score), false);
+    EXPECT_EQ(score->selection().elements().size(), 2u * 4);
+
+    score->selectSimilar(firstDynamic(score), true);
+    EXPECT_EQ(score->selection().elements().size(), 4u);
+    for (EngravingItem* e : score->selection().elements()) {
+        EXPECT_TRUE(e->isDynamic());
+        EXPECT_EQ(e->staffIdx(), 0u);
+    }
+
+    delete score;
+}
+
+TEST_F(Engraving_SelectSimilarTests, DISABLED_benchmarkDynamics)
+{
+    // 100,000 notes, 5,000 dynamics
+    MasterScore* score = TestUtils::createNotesScore(10, 2500);
+    ASSERT_TRUE(score);
+    addDynamics(score);
+
+    EngravingItem* item = firstDynamic(score);
+    auto duration = TestUtils::averageDuration(1, [score, item](int) {
+        score->selectSimilar(item, false);
+    });
+
+    LOGI() << "select similar of " << score->selection().elements().size() << " dynamics: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
+
+TEST_F(Engraving_SelectSimilarTests, DISABLED_benchmark)
+{
+    // 100,000 notes
+    MasterScore* score = TestUtils::createNotesScore(10, 2500);
+    ASSERT_TRUE(score);
+
+    EngravingItem* item = firstNote(score);
+    auto duration = TestUtils::averageDuration(1, [score, item](int) {
+        score->selectSimilar(item, false);
+    });
+
+    LOGI() << "select similar of " << score->selection().elements().size() << " notes: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
@@ -25,15 +25,23 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "dom/chordrest.h"
 #include "dom/dynamic.h"
+#include "dom/factory.h"
 #include "dom/masterscore.h"
+#include "dom/measure.h"
 #include "dom/segment.h"
+#include "dom/staff.h"
 #include "dom/stafftext.h"
 #include "dom/textedit.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
+#include "utils/testutils.h"
+
+#include "log.h"
 
 using namespace mu;
 using namespace mu::engraving;
@@ -199,3 +207,80 @@ TEST_F(Engraving_TextBaseTests, musicalSymbolsNotItalic)
     EXPECT_TRUE(fragmentList.front().font(dynamic).italic());
     EXPECT_TRUE(!std::next(fragmentList.begin())->font(dynamic).italic());
 }
+
+// adds a swing staff text to the first segment of every measure
+static void addSwingTexts(MasterScore* score, int swingRatio)
+{
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        Segment* segment = m->first(SegmentType::ChordRest);
+        StaffText* text = Factory::createStaffText(segment);
+        text->setXmlText(u"Swing");
+        text->setSwing(true);
+        text->setSwingParameters(Constants::DIVISION / 2, swingRatio);
+        text->setTrack(0);
+        text->setParent(segment);
+        score->undoAddElement(text);
+    }
+}
+
+TEST_F(Engraving_TextBaseTests, swingTextsInChangesBatch)
+{
+    MasterScore* score = TestUtils::createNotesScore(1, 8);
+    ASSERT_TRUE(score);
+    Staff* staff = score->staff(0);
+    const Fraction lastTick = score->lastMeasure()->tick();
+
+    score->startCmd(TranslatableString::untranslatable("Swing text tests"));
+    {
+        ScoreChangesBatch changesBatch(score);
+        addSwingTexts(score, 75);
+
+        // the swing list is rebuilt when the batch ends
+        EXPECT_TRUE(score->isChangesBatchOpen());
+        EXPECT_EQ(staff->swing(lastTick).swingRatio, 60);
+    }
+    EXPECT_FALSE(score->isChangesBatchOpen());
+    EXPECT_EQ(staff->swing(lastTick).swingRatio, 75);
+    score->endCmd();
+
+    // undo runs in a batch too
+    score->undoRedo(true, nullptr);
+    EXPECT_FALSE(score->isChangesBatchOpen());
+    EXPECT_EQ(staff->swing(lastTick).swingRatio, 60);
+
+    score->undoRedo(false, nullptr);
+    EXPECT_EQ(staff->swing(lastTick).swingRatio, 75);
+
+    delete score;
+}
+
+TEST_F(Engraving_TextBaseTests, DISABLED_benchmarkSwingTextsChangesBatch)
+{
+    MasterScore* score = TestUtils::createNotesScore(1, 1000);
+    ASSERT_TRUE(score);
+
+    auto duration = TestUtils::averageDuration(1, [score](int) {
+        score->startCmd(TranslatableString::untranslatable("Swing text benchmark"));
+        addSwingTexts(score, 66);
+        score->endCmd();
+    });
+
+    LOGI() << "add " << score->nmeasures() << " swing texts one by one: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    score->undoRedo(true, nullptr);
+
+    duration = TestUtils::averageDuration(1, [score](int) {
+        score->startCmd(TranslatableString::untranslatable("Swing text benchmark"));
+        {
+            ScoreChangesBatch changesBatch(score);
+            addSwingTexts(score, 66);
+        }
+        score->endCmd();
+    });
+
+    LOGI() << "add " << score->nmeasures() << " swing texts in a changes batch: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete score;
+}
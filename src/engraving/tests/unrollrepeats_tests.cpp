@@ -22,10 +22,21 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
+#include "dom/chord.h"
+#include "dom/factory.h"
 #include "dom/masterscore.h"
+#include "dom/measure.h"
+#include "dom/note.h"
+#include "dom/segment.h"
+#include "dom/stafftext.h"
 
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
+#include "utils/testutils.h"
+
+#include "log.h"
 
 using namespace mu;
 using namespace mu::engraving;
@@ -65,3 +76,93 @@ TEST_F(Engraving_UnrollRepeatsTests, DISABLED_pickupMeasure)
 
     EXPECT_TRUE(ScoreComp::saveCompareScore(unrolled, u"pickup-measure-test.mscx", UNROLLREPEATS_DATA_DIR + u"pickup-measure-ref.mscx"));
 }
+
+//---------------------------------------------------------
+//   createScoreWithStaffTexts
+//    every staff gets a staff text per measure, added in
+//    reverse staff order; every group of repeatEvery
+//    measures is repeated
+//---------------------------------------------------------
+
+static MasterScore* createScoreWithStaffTexts(size_t staves, int measures, int repeatEvery)
+{
+    MasterScore* score = TestUtils::createNotesScore(staves, measures);
+    int measureIdx = 0;
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure(), ++measureIdx) {
+        Segment* segment = m->first(SegmentType::ChordRest);
+        for (size_t staffIdx = staves; staffIdx-- > 0;) {
+            StaffText* text = Factory::createStaffText(segment);
+            text->setXmlText(String(u"%1-%2").arg(static_cast<int>(staffIdx), measureIdx));
+            text->setTrack(staffIdx * VOICES);
+            text->setParent(segment);
+            segment->add(text);
+        }
+    }
+    for (int first = 0; first + repeatEvery <= measures; first += repeatEvery) {
+        TestUtils::addRepeat(score, first, first + repeatEvery - 1);
+    }
+
+    score->doLayout();
+    return score;
+}
+
+//---------------------------------------------------------
+///   clonedMeasures
+///   the measures cloned for the repeated sections keep
+///   the notes and the staff texts of every staff
+//---------------------------------------------------------
+
+TEST_F(Engraving_UnrollRepeatsTests, clonedMeasures)
+{
+    constexpr size_t STAVES = 3;
+    MasterScore* score = createScoreWithStaffTexts(STAVES, 4, 2);
+    ASSERT_TRUE(score);
+
+    MasterScore* unrolled = score->unrollRepeats();
+    ASSERT_TRUE(unrolled);
+    ASSERT_EQ(unrolled->nmeasures(), 8u);
+
+    // unrolled measure i plays measure (i / 4) * 2 + i % 2 of the original
+    int measureIdx = 0;
+    for (Measure* m = unrolled->firstMeasure(); m; m = m->nextMeasure(), ++measureIdx) {
+        const int originalIdx = (measureIdx / 4) * 2 + measureIdx % 2;
+        Measure* om = score->crMeasure(originalIdx);
+        EXPECT_FALSE(m->repeatStart());
+        EXPECT_FALSE(m->repeatEnd());
+
+        Segment* segment = m->first(SegmentType::ChordRest);
+        Segment* osegment = om->first(SegmentType::ChordRest);
+        ASSERT_EQ(segment->annotations().size(), STAVES);
+        for (size_t staffIdx = 0; staffIdx < STAVES; ++staffIdx) {
+            // staff texts end up in track order
+            EngravingItem* text = segment->annotations().at(staffIdx);
+            ASSERT_TRUE(text->isStaffText());
+            EXPECT_EQ(text->track(), staffIdx * VOICES);
+            EXPECT_EQ(toStaffText(text)->xmlText(), String(u"%1-%2").arg(static_cast<int>(staffIdx), originalIdx));
+
+            Chord* chord = toChord(segment->element(staffIdx * VOICES));
+            Chord* ochord = toChord(osegment->element(staffIdx * VOICES));
+            EXPECT_EQ(chord->upNote()->pitch(), ochord->upNote()->pitch());
+        }
+    }
+
+    delete unrolled;
+    delete score;
+}
+
+TEST_F(Engraving_UnrollRepeatsTests, DISABLED_benchmark)
+{
+    MasterScore* score = createScoreWithStaffTexts(32, 200, 4);
+    ASSERT_TRUE(score);
+
+    MasterScore* unrolled = nullptr;
+    auto duration = TestUtils::averageDuration(1, [score, &unrolled](int) {
+        unrolled = score->unrollRepeats();
+    });
+
+    LOGI() << "unroll repeats of " << score->nmeasures() << " measures in " << score->nstaves() << " staves: "
+           << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms";
+
+    delete unrolled;
+    delete score;
+}
@@ -21,10 +21,15 @@
  */
 #include "testutils.h"
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
+#include "dom/chord.h"
 #include "dom/excerpt.h"
 #include "dom/masterscore.h"
+#include "dom/mcursor.h"
+#include "dom/measure.h"
 #include "dom/part.h"
 #include "dom/score.h"
 
@@ -58,3 +63,54 @@ void TestUtils::createParts(MasterScore* masterScore, size_t numberOfParts)
         createPart(masterScore, part);
     }
 }
+
+MasterScore* TestUtils::createNotesScore(size_t staves, int measures, DurationType duration, const std::vector<String>& instruments,
+                                         const std::function<void(Chord*, int)>& onChord)
+{
+    MCursor c;
+    c.setTimeSig(Fraction(4, 4));
+    c.createScore(nullptr, u"notes");
+    for (size_t i = 0; i < staves; ++i) {
+        c.addPart(instruments.at(i % instruments.size()));
+    }
+
+    const TDuration d(duration);
+    const int notesPerMeasure = (Fraction(1, 1) / d.fraction()).numerator();
+    for (size_t staffIdx = 0; staffIdx < staves; ++staffIdx) {
+        c.move(static_cast<int>(staffIdx * VOICES), Fraction(0, 1));
+        for (int i = 0; i < measures * notesPerMeasure; ++i) {
+            Chord* chord = c.addChord(60 + (i + static_cast<int>(staffIdx)) % 12, d);
+            if (onChord) {
+                onChord(chord, i);
+            }
+        }
+    }
+
+    MasterScore* score = c.score();
+    score->doLayout();
+    return score;
+}
+
+void TestUtils::addRepeat(MasterScore* masterScore, int firstMeasure, int lastMeasure)
+{
+    Measure* first = masterScore->crMeasure(firstMeasure);
+    Measure* last = masterScore->crMeasure(lastMeasure);
+    EXPECT_TRUE(first && last);
+    if (!first || !last) {
+        return;
+    }
+
+    first->setRepeatStart(true);
+    last->setRepeatEnd(true);
+}
+
+std::chrono::microseconds TestUtils::averageDuration(int iterations, const std::function<void(int)>& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start) / std::max(iterations, 1);
+}
@@ -23,14 +23,33 @@
 #ifndef MU_ENGRAVING_TESTUTILS_H
 #define MU_ENGRAVING_TESTUTILS_H
 
+#include <chrono>
+#include <functional>
+
+#include "dom/durationtype.h"
 #include "dom/score.h"
 
 namespace mu::engraving {
+class Chord;
+
 class TestUtils
 {
 public:
     static Score* createPart(MasterScore* masterScore, size_t partNumber = 0);
     static void createParts(MasterScore* masterScore, size_t numberOfParts);
+
+    //! Creates a laid out score in memory: one part per staff, taking the instruments in turn,
+    //! each staff filled with notes of one duration. `onChord` is called for every added chord
+    //! with its index on the staff, before the layout.
+    static MasterScore* createNotesScore(size_t staves, int measures, DurationType duration = DurationType::V_QUARTER,
+                                         const std::vector<String>& instruments = { u"flute" },
+                                         const std::function<void(Chord*, int)>& onChord = nullptr);
+
+    //! Marks the measures firstMeasure..lastMeasure (0-based) as a repeated section
+    static void addRepeat(MasterScore* masterScore, int firstMeasure, int lastMeasure);
+
+    //! Average duration of `iterations` calls of `func`, which gets the iteration index
+    static std::chrono::microseconds averageDuration(int iterations, const std::function<void(int)>& func);
 };
 }
 
@@ -23,6 +23,9 @@
 #ifndef MUSE_AUDIO_AUDIOTYPES_H
 #define MUSE_AUDIO_AUDIOTYPES_H
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <variant>
 #include <set>
 #include <string>
@@ -348,17 +351,94 @@ struct AudioSignalVal {
     volume_dbfs_t pressure = 0.f;
 };
 
-using AudioSignalValuesMap = std::map<audioch_t, AudioSignalVal>;
-using AudioSignalChanges = async::Channel<AudioSignalValuesMap>;
+//! NOTE Latest signal values of the audio channels of a track, written by the audio worker thread
+//! and polled by the UI at its refresh rate. Each channel is guarded by its own sequence counter (seqlock),
+//! so neither side locks or allocates
+class AudioSignalsSnapshot
+{
+public:
+    static constexpr audioch_t MAX_CHANNELS = 8;
+
+    void setSignalValue(const audioch_t audioChNumber, const AudioSignalVal& val)
+    {
+        if (audioChNumber >= MAX_CHANNELS) {
+            return;
+        }
+
+        ChannelValues& ch = m_channels[audioChNumber];
+        uint32_t seq = ch.sequence.load(std::memory_order_relaxed);
+        ch.sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        ch.amplitude.store(val.amplitude, std::memory_order_relaxed);
+        ch.pressure.store(val.pressure.raw(), std::memory_order_relaxed);
+
+        ch.sequence.store(seq + 2, std::memory_order_release);
+
+        if (audioChNumber >= m_channelsCount.load(std::memory_order_relaxed)) {
+            m_channelsCount.store(static_cast<audioch_t>(audioChNumber + 1), std::memory_order_relaxed);
+        }
+        m_revision.fetch_add(1, std::memory_order_release);
+    }
+
+    AudioSignalVal signalValue(const audioch_t audioChNumber) const
+    {
+        AudioSignalVal val;
+        if (audioChNumber >= MAX_CHANNELS) {
+            return val;
+        }
+
+        const ChannelValues& ch = m_channels[audioChNumber];
+        uint32_t seqBefore = 0;
+        uint32_t seqAfter = 0;
+        do {
+            seqBefore = ch.sequence.load(std::memory_order_acquire);
+            val.amplitude = ch.amplitude.load(std::memory_order_relaxed);
+            val.pressure = volume_dbfs_t::make(ch.pressure.load(std::memory_order_relaxed));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            seqAfter = ch.sequence.load(std::memory_order_relaxed);
+        } while ((seqBefore & 1) || seqBefore != seqAfter);
+
+        return val;
+    }
+
+    audioch_t channelsCount() const
+    {
+        return m_channelsCount.load(std::memory_order_relaxed);
+    }
+
+    //! NOTE Changes every time a value is written, lets readers skip unchanged snapshots
+    uint64_t revision() const
+    {
+        return m_revision.load(std::memory_order_acquire);
+    }
+
+private:
+    struct ChannelValues {
+        std::atomic<uint32_t> sequence = 0;
+        std::atomic<float> amplitude = 0.f;
+        std::atomic<float> pressure = 0.f;
+    };
+
+    std::array<ChannelValues, MAX_CHANNELS> m_channels;
+    std::atomic<audioch_t> m_channelsCount = 0;
+    std::atomic<uint64_t> m_revision = 0;
+};
+
+using AudioSignalsSnapshotPtr = std::shared_ptr<const AudioSignalsSnapshot>;
 
 static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = volume_dbfs_t::make(-100.f);
 struct AudioSignalsNotifier {
     void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude)
     {
+        if (audioChNumber >= AudioSignalsSnapshot::MAX_CHANNELS) {
+            return;
+        }
+
         volume_dbfs_t newPressure = (newAmplitude > 0.f) ? volume_dbfs_t(muse::linear_to_db(newAmplitude)) : MINIMUM_OPERABLE_DBFS_LEVEL;
         newPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
 
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
+        AudioSignalVal& signalVal = m_signalValues[audioChNumber];
 
         if (muse::is_equal(signalVal.pressure, newPressure)) {
             return;
@@ -371,24 +451,19 @@ struct AudioSignalsNotifier {
         signalVal.amplitude = newAmplitude;
         signalVal.pressure = newPressure;
 
-        m_needNotifyAboutChanges = true;
+        m_snapshot->setSignalValue(audioChNumber, signalVal);
     }
 
-    void notifyAboutChanges()
+    AudioSignalsSnapshotPtr snapshot() const
     {
-        if (m_needNotifyAboutChanges) {
-            audioSignalChanges.send(m_signalValuesMap);
-            m_needNotifyAboutChanges = false;
-        }
+        return m_snapshot;
     }
 
-    AudioSignalChanges audioSignalChanges;
-
 private:
     static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = volume_dbfs_t::make(2.5f);
 
-    AudioSignalValuesMap m_signalValuesMap;
-    bool m_needNotifyAboutChanges = false;
+    std::array<AudioSignalVal, AudioSignalsSnapshot::MAX_CHANNELS> m_signalValues;
+    std::shared_ptr<AudioSignalsSnapshot> m_snapshot = std::make_shared<AudioSignalsSnapshot>();
 };
 
 enum class PlaybackStatus {
@@ -151,9 +151,9 @@ Promise<AudioResourceMetaList> AudioOutputHandler::availableOutputResources() co
     }, AudioThread::ID);
 }
 
-Promise<AudioSignalChanges> AudioOutputHandler::signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const
+Promise<AudioSignalsSnapshotPtr> AudioOutputHandler::signalValues(const TrackSequenceId sequenceId, const TrackId trackId) const
 {
-    return Promise<AudioSignalChanges>([this, sequenceId, trackId](auto resolve, auto reject) {
+    return Promise<AudioSignalsSnapshotPtr>([this, sequenceId, trackId](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         ITrackSequencePtr s = sequence(sequenceId);
@@ -166,20 +166,20 @@ Promise<AudioSignalChanges> AudioOutputHandler::signalChanges(const TrackSequenc
             return reject(static_cast<int>(Err::InvalidTrackId), "no track");
         }
 
-        return resolve(s->audioIO()->audioSignalChanges(trackId));
+        return resolve(s->audioIO()->audioSignals(trackId));
     }, AudioThread::ID);
 }
 
-Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
+Promise<AudioSignalsSnapshotPtr> AudioOutputHandler::masterSignalValues() const
 {
-    return Promise<AudioSignalChanges>([this](auto resolve, auto reject) {
+    return Promise<AudioSignalsSnapshotPtr>([this](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
             return reject(static_cast<int>(Err::Undefined), "undefined reference to a mixer");
         }
 
-        return resolve(mixer()->masterAudioSignalChanges());
+        return resolve(mixer()->masterAudioSignals());
     }, AudioThread::ID);
 }
 
@@ -417,9 +417,9 @@ Channel<AudioOutputParams> Mixer::masterOutputParamsChanged() const
     return m_masterOutputParamsChanged;
 }
 
-AudioSignalChanges Mixer::masterAudioSignalChanges() const
+AudioSignalsSnapshotPtr Mixer::masterAudioSignals() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignalNotifier.snapshot();
 }
 
 void Mixer::setIsIdle(bool idle)
@@ -557,7 +557,6 @@ void Mixer::completeOutput(float* buffer, samples_t samplesPerChannel)
     }
 
     m_isSilence = RealIsNull(totalSquaredSum);
-    m_audioSignalNotifier.notifyAboutChanges();
 
     if (!m_limiter->isActive()) {
         return;
@@ -572,8 +571,6 @@ void Mixer::notifyNoAudioSignal()
     for (audioch_t audioChNum = 0; audioChNum < m_audioChannelsCount; ++audioChNum) {
         m_audioSignalNotifier.updateSignalValues(audioChNum, 0.f);
     }
-
-    m_audioSignalNotifier.notifyAboutChanges();
 }
 
 msecs_t Mixer::currentTime() const
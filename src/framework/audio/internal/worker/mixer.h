@@ -67,7 +67,7 @@ public:
     void clearMasterOutputParams();
     async::Channel<AudioOutputParams> masterOutputParamsChanged() const;
 
-    AudioSignalChanges masterAudioSignalChanges() const;
+    AudioSignalsSnapshotPtr masterAudioSignals() const;
 
     void setIsIdle(bool idle);
     void setTracksToProcessWhenIdle(std::unordered_set<TrackId>&& trackIds);
@@ -138,9 +138,9 @@ async::Channel<AudioOutputParams> MixerChannel::outputParamsChanged() const
     return m_paramsChanges;
 }
 
-AudioSignalChanges MixerChannel::audioSignalChanges() const
+AudioSignalsSnapshotPtr MixerChannel::audioSignals() const
 {
-    return m_audioSignalNotifier.audioSignalChanges;
+    return m_audioSignalNotifier.snapshot();
 }
 
 bool MixerChannel::isActive() const
@@ -244,7 +244,6 @@ void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount)
     }
 
     m_isSilent = RealIsNull(totalSquaredSum);
-    m_audioSignalNotifier.notifyAboutChanges();
 
     if (!m_compressor->isActive()) {
         return;
@@ -266,6 +265,4 @@ void MixerChannel::notifyNoAudioSignal()
     for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
         m_audioSignalNotifier.updateSignalValues(audioChNum, 0.f);
     }
-
-    m_audioSignalNotifier.notifyAboutChanges();
 }
@@ -56,7 +56,7 @@ public:
     void applyOutputParams(const AudioOutputParams& requiredParams) override;
     async::Channel<AudioOutputParams> outputParamsChanged() const override;
 
-    AudioSignalChanges audioSignalChanges() const override;
+    AudioSignalsSnapshotPtr audioSignals() const override;
 
     bool isActive() const override;
     void setIsActive(bool arg) override;
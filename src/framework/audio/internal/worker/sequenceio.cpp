@@ -144,7 +144,7 @@ Channel<TrackId, AudioOutputParams> SequenceIO::outputParamsChanged() const
     return m_outputParamsChanged;
 }
 
-AudioSignalChanges SequenceIO::audioSignalChanges(const TrackId id) const
+AudioSignalsSnapshotPtr SequenceIO::audioSignals(const TrackId id) const
 {
     ONLY_AUDIO_WORKER_THREAD;
 
@@ -154,8 +154,8 @@ AudioSignalChanges SequenceIO::audioSignalChanges(const TrackId id) const
 
     TrackPtr track = m_getTracks->track(id);
     IF_ASSERT_FAILED(track) {
-        return AudioSignalChanges();
+        return nullptr;
     }
 
-    return track->outputHandler->audioSignalChanges();
+    return track->outputHandler->audioSignals();
 }
@@ -46,7 +46,7 @@ public:
     async::Channel<TrackId, AudioInputParams> inputParamsChanged() const override;
     async::Channel<TrackId, AudioOutputParams> outputParamsChanged() const override;
 
-    AudioSignalChanges audioSignalChanges(const TrackId id) const override;
+    AudioSignalsSnapshotPtr audioSignals(const TrackId id) const override;
 
 private:
     IGetTracks* m_getTracks = nullptr;
@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+#include "audio/audiotypes.h"
+
+using namespace muse;
+using namespace muse::audio;
+
+//! NOTE Counts the allocations made by the current thread while counting is enabled
+static thread_local bool s_countAllocations = false;
+static thread_local size_t s_allocationsCount = 0;
+
+void* operator new(std::size_t size)
+{
+    if (s_countAllocations) {
+        ++s_allocationsCount;
+    }
+
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+class Audio_AudioSignalsTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Audio_AudioSignalsTests, UpdateSignalValues_NoAllocations)
+{
+    //! GIVEN Notifier of a stereo channel
+    AudioSignalsNotifier notifier;
+    AudioSignalsSnapshotPtr snapshot = notifier.snapshot();
+
+    //! DO Update the levels as the audio thread does for every processed block
+    s_allocationsCount = 0;
+    s_countAllocations = true;
+
+    for (int block = 0; block < 10000; ++block) {
+        float amplitude = static_cast<float>(block % 100) / 100.f;
+        notifier.updateSignalValues(0, amplitude);
+        notifier.updateSignalValues(1, amplitude / 2.f);
+    }
+
+    s_countAllocations = false;
+
+    //! CHECK
+    EXPECT_EQ(s_allocationsCount, 0);
+    EXPECT_EQ(snapshot->channelsCount(), 2);
+    EXPECT_GT(snapshot->revision(), 0);
+}
+
+TEST_F(Audio_AudioSignalsTests, UpdateSignalValues_Snapshot)
+{
+    //! GIVEN Notifier of a stereo channel
+    AudioSignalsNotifier notifier;
+    AudioSignalsSnapshotPtr snapshot = notifier.snapshot();
+    EXPECT_EQ(snapshot->channelsCount(), 0);
+
+    //! DO
+    notifier.updateSignalValues(0, 0.5f);
+    notifier.updateSignalValues(1, 0.f);
+
+    //! CHECK
+    EXPECT_EQ(snapshot->channelsCount(), 2);
+    EXPECT_FLOAT_EQ(snapshot->signalValue(0).amplitude, 0.5f);
+    EXPECT_FLOAT_EQ(snapshot->signalValue(0).pressure.raw(), muse::linear_to_db(0.5f));
+    EXPECT_FLOAT_EQ(snapshot->signalValue(1).pressure.raw(), MINIMUM_OPERABLE_DBFS_LEVEL.raw());
+
+    //! DO Change that is smaller than the minimal valuable difference
+    uint64_t revision = snapshot->revision();
+    notifier.updateSignalValues(0, 0.45f);
+
+    //! CHECK The snapshot is not changed
+    EXPECT_EQ(snapshot->revision(), revision);
+    EXPECT_FLOAT_EQ(snapshot->signalValue(0).amplitude, 0.5f);
+}
+
+TEST_F(Audio_AudioSignalsTests, Snapshot_ConcurrentRead)
+{
+    //! GIVEN The audio thread keeps writing consistent pairs of values
+    AudioSignalsSnapshot snapshot;
+    std::atomic<bool> done = false;
+
+    std::thread writer([&]() {
+        for (int i = 0; i < 200000; ++i) {
+            float value = static_cast<float>(i % 1000);
+            snapshot.setSignalValue(0, { value, volume_dbfs_t::make(-value) });
+        }
+        done = true;
+    });
+
+    //! CHECK The reader never sees a torn value
+    bool consistent = true;
+    while (!done) {
+        AudioSignalVal val = snapshot.signalValue(0);
+        if (!RealIsEqual(val.amplitude, -val.pressure.raw())) {
+            consistent = false;
+        }
+    }
+
+    writer.join();
+
+    EXPECT_TRUE(consistent);
+}
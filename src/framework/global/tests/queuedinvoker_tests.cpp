@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "thirdparty/kors_async/async/internal/queuedinvoker.h"
+
+#include "log.h"
+
+using namespace kors::async;
+
+class Global_Async_QueuedInvokerTests : public ::testing::Test
+{
+public:
+    struct Result {
+        size_t received = 0;
+        bool ordered = true;
+    };
+
+    //! NOTE Producers send numbered functors to the consumer thread,
+    //! the consumer checks that each producer's functors arrive in order
+    static Result run(size_t producerCount, size_t countPerProducer, bool startConsumerLate)
+    {
+        std::vector<size_t> lastReceived(producerCount, 0);
+        Result result;
+        const size_t total = producerCount * countPerProducer;
+
+        std::atomic<bool> consumerReady = false;
+        std::atomic<bool> producersDone = false;
+        std::thread::id consumerID;
+
+        std::thread consumer([&]() {
+            consumerReady = true;
+            if (startConsumerLate) {
+                while (!producersDone) {
+                    std::this_thread::yield();
+                }
+            }
+
+            while (result.received < total) {
+                QueuedInvoker::instance()->processEvents();
+                std::this_thread::yield();
+            }
+        });
+
+        consumerID = consumer.get_id();
+        while (!consumerReady) {
+            std::this_thread::yield();
+        }
+
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < producerCount; ++p) {
+            producers.emplace_back([&, p]() {
+                for (size_t i = 1; i <= countPerProducer; ++i) {
+                    QueuedInvoker::instance()->invoke(consumerID, [&result, &lastReceived, p, i]() {
+                        if (lastReceived[p] + 1 != i) {
+                            result.ordered = false;
+                        }
+                        lastReceived[p] = i;
+                        ++result.received;
+                    });
+                }
+            });
+        }
+
+        for (std::thread& t : producers) {
+            t.join();
+        }
+        producersDone = true;
+        consumer.join();
+
+        return result;
+    }
+};
+
+TEST_F(Global_Async_QueuedInvokerTests, MultipleProducers)
+{
+    //! DO
+    Result result = run(4, 10000, false);
+
+    //! CHECK
+    EXPECT_EQ(result.received, 40000);
+    EXPECT_TRUE(result.ordered);
+}
+
+TEST_F(Global_Async_QueuedInvokerTests, MultipleProducers_Overflow)
+{
+    //! GIVEN The consumer does not process events until all functors are sent,
+    //! so more functors are queued than fit into the preallocated slots
+
+    //! DO
+    Result result = run(4, 5000, true);
+
+    //! CHECK
+    EXPECT_EQ(result.received, 20000);
+    EXPECT_TRUE(result.ordered);
+}
+
+TEST_F(Global_Async_QueuedInvokerTests, DISABLED_ContentionBenchmark)
+{
+    for (size_t producers : { 1, 2, 4, 8 }) {
+        auto start = std::chrono::steady_clock::now();
+        Result result = run(producers, 200000, false);
+        auto end = std::chrono::steady_clock::now();
+
+        EXPECT_TRUE(result.ordered);
+        LOGI() << producers << " producers, " << result.received << " functors: "
+               << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms";
+    }
+}
@@ -21,6 +21,7 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cstring>
 #include <regex>
 #include <string>
@@ -987,3 +988,120 @@ TEST_F(Global_Types_StringTests, String_FromUtf16LE)
         EXPECT_EQ(str, u"< xml");
     }
 }
+
+TEST_F(Global_Types_StringTests, String_CopyOnWrite)
+{
+    {
+        //! GIVEN Short string and its copy
+        String str = u"abc";
+        String copy = str;
+        //! DO
+        copy.append(u'd');
+        copy[0] = u'x';
+        //! CHECK
+        EXPECT_EQ(str, u"abc");
+        EXPECT_EQ(copy, u"xbcd");
+    }
+
+    {
+        //! GIVEN Long string and its copy
+        String str = u"A long string that does not fit into the short string buffer";
+        String copy = str;
+        //! DO
+        copy[0] = u'a';
+        copy.replace(u"buffer", u"inline");
+        //! CHECK
+        EXPECT_EQ(str, u"A long string that does not fit into the short string buffer");
+        EXPECT_EQ(copy, u"a long string that does not fit into the short string inline");
+    }
+
+    {
+        //! GIVEN Short string that grows into a long one and shrinks back
+        String str = u"ab";
+        String copy = str;
+        //! DO
+        for (int i = 0; i < 100; ++i) {
+            str += u'c';
+        }
+        String grown = str;
+        str.truncate(2);
+        //! CHECK
+        EXPECT_EQ(str, u"ab");
+        EXPECT_EQ(copy, u"ab");
+        EXPECT_EQ(grown.size(), 102);
+        EXPECT_EQ(grown.count(Char(u'c')), 100);
+    }
+
+    {
+        //! GIVEN Empty strings
+        String empty;
+        String cleared = u"A long string that does not fit into the short string buffer";
+        String copy = cleared;
+        //! DO
+        cleared.clear();
+        //! CHECK
+        EXPECT_TRUE(empty.empty());
+        EXPECT_TRUE(cleared.empty());
+        EXPECT_EQ(empty, cleared);
+        EXPECT_EQ(empty.hash(), cleared.hash());
+        EXPECT_EQ(copy, u"A long string that does not fit into the short string buffer");
+    }
+
+    {
+        //! GIVEN Long strings built in place from an empty one
+        String ascii = String::fromAscii("A LONG ASCII STRING THAT IS CONVERTED IN PLACE");
+        String copy = ascii;
+        //! DO
+        String lower = ascii.toLower();
+        //! CHECK
+        EXPECT_EQ(ascii, u"A LONG ASCII STRING THAT IS CONVERTED IN PLACE");
+        EXPECT_EQ(copy, ascii);
+        EXPECT_EQ(lower, u"a long ascii string that is converted in place");
+    }
+}
+
+TEST_F(Global_Types_StringTests, DISABLED_String_Benchmark)
+{
+    constexpr size_t COUNT = 1000000;
+
+    auto measure = [](const char* name, const auto& func) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        auto end = std::chrono::steady_clock::now();
+        LOGI() << name << ": " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us";
+    };
+
+    measure("construct empty", [&]() {
+        std::vector<String> strings(COUNT);
+        EXPECT_TRUE(strings.back().empty());
+    });
+
+    measure("construct short", [&]() {
+        std::vector<String> strings;
+        strings.reserve(COUNT);
+        for (size_t i = 0; i < COUNT; ++i) {
+            strings.emplace_back(u"note");
+        }
+        EXPECT_EQ(strings.back(), u"note");
+    });
+
+    measure("copy short", [&]() {
+        const String str = u"staff";
+        std::vector<String> strings(COUNT, str);
+        EXPECT_EQ(strings.back(), str);
+    });
+
+    measure("copy long", [&]() {
+        const String str = u"A long string that does not fit into the short string buffer";
+        std::vector<String> strings(COUNT, str);
+        EXPECT_EQ(strings.back(), str);
+    });
+
+    measure("number", [&]() {
+        size_t total = 0;
+        for (size_t i = 0; i < COUNT; ++i) {
+            total += String::number(static_cast<int>(i % 1000)).size();
+        }
+        EXPECT_GT(total, 0);
+    });
+}
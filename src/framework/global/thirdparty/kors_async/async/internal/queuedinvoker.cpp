@@ -31,28 +31,154 @@ QueuedInvoker* QueuedInvoker::instance()
     return &i;
 }
 
+QueuedInvoker::~QueuedInvoker()
+{
+    ThreadQueue* q = m_queues.load(std::memory_order_acquire);
+    while (q) {
+        ThreadQueue* next = q->next;
+        delete q;
+        q = next;
+    }
+}
+
+QueuedInvoker::ThreadQueue* QueuedInvoker::findQueue(const std::thread::id& th, ThreadQueue* from, ThreadQueue* to) const
+{
+    for (ThreadQueue* q = from; q && q != to; q = q->next) {
+        if (q->threadID() == th) {
+            return q;
+        }
+    }
+    return nullptr;
+}
+
+QueuedInvoker::ThreadQueue* QueuedInvoker::queue(const std::thread::id& th)
+{
+    //! NOTE Queues are only ever added to the head of the list and live as long as the invoker,
+    //! so the list can be read without locking
+    ThreadQueue* head = m_queues.load(std::memory_order_acquire);
+    if (ThreadQueue* q = findQueue(th, head)) {
+        return q;
+    }
+
+    ThreadQueue* newQueue = new ThreadQueue(th);
+    newQueue->next = head;
+    while (!m_queues.compare_exchange_weak(newQueue->next, newQueue, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        //! NOTE Another thread has added a queue, maybe for the same thread
+        if (ThreadQueue* q = findQueue(th, newQueue->next, head)) {
+            delete newQueue;
+            return q;
+        }
+        head = newQueue->next;
+    }
+
+    return newQueue;
+}
+
 void QueuedInvoker::invoke(const std::thread::id& callbackTh, const Functor& f, bool isAlwaysQueued)
 {
     if (m_onMainThreadInvoke) {
         if (callbackTh == m_mainThreadID) {
             m_onMainThreadInvoke(f, isAlwaysQueued);
+            return;
         }
     }
 
-    std::lock_guard<std::recursive_mutex> lock(m_mutex);
-    m_queues[callbackTh].push(f);
+    queue(callbackTh)->push(f);
 }
 
 void QueuedInvoker::processEvents()
 {
-    Queue q;
-    {
-        std::lock_guard<std::recursive_mutex> lock(m_mutex);
-        auto n = m_queues.extract(std::this_thread::get_id());
-        if (!n.empty()) {
-            q = n.mapped();
+    queue(std::this_thread::get_id())->process();
+}
+
+void QueuedInvoker::onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f)
+{
+    m_onMainThreadInvoke = f;
+    m_mainThreadID = std::this_thread::get_id();
+}
+
+// ThreadQueue
+
+QueuedInvoker::ThreadQueue::ThreadQueue(const std::thread::id& th)
+    : m_threadID(th), m_slots(new Slot[CAPACITY])
+{
+    for (size_t i = 0; i < CAPACITY; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+void QueuedInvoker::ThreadQueue::push(const Functor& f)
+{
+    //! NOTE Once something is in the overflow queue, keep using it until the consumer has taken it,
+    //! so that functors from the same producer are called in order
+    if (m_overflowSize.load(std::memory_order_acquire) == 0 && tryPush(f)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    m_overflow.push(f);
+    m_overflowSize.store(m_overflow.size(), std::memory_order_release);
+}
+
+bool QueuedInvoker::ThreadQueue::tryPush(const Functor& f)
+{
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;) {
+        slot = &m_slots[pos % CAPACITY];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // full
+            return false;
+        } else {
+            pos = m_tail.load(std::memory_order_relaxed);
         }
     }
+
+    slot->f = f;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+void QueuedInvoker::ThreadQueue::process()
+{
+    for (;;) {
+        Slot& slot = m_slots[m_head % CAPACITY];
+        if (slot.sequence.load(std::memory_order_acquire) != m_head + 1) {
+            break;
+        }
+
+        Functor f = std::move(slot.f);
+        slot.f = nullptr;
+        slot.sequence.store(m_head + CAPACITY, std::memory_order_release);
+        ++m_head;
+
+        if (f) {
+            f();
+        }
+    }
+
+    if (m_overflowSize.load(std::memory_order_acquire) == 0) {
+        return;
+    }
+
+    //! NOTE A producer is still writing into the ring, the overflow is taken next time to keep the order
+    if (m_head != m_tail.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::queue<Functor> q;
+    {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        q.swap(m_overflow);
+        m_overflowSize.store(0, std::memory_order_release);
+    }
+
     while (!q.empty()) {
         const auto& f = q.front();
         if (f) {
@@ -61,9 +187,3 @@ void QueuedInvoker::processEvents()
         q.pop();
     }
 }
-
-void QueuedInvoker::onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f)
-{
-    m_onMainThreadInvoke = f;
-    m_mainThreadID = std::this_thread::get_id();
-}
@@ -24,10 +24,12 @@ SOFTWARE.
 #ifndef KORS_ASYNC_QUEUEDINVOKER_H
 #define KORS_ASYNC_QUEUEDINVOKER_H
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
-#include <queue>
-#include <map>
+#include <memory>
 #include <mutex>
+#include <queue>
 #include <thread>
 
 namespace kors::async {
@@ -46,11 +48,47 @@ public:
 private:
 
     QueuedInvoker() = default;
+    ~QueuedInvoker();
+
+    //! NOTE Multiple producers, single consumer (the thread that owns the queue).
+    //! Functors are placed into preallocated slots without locking,
+    //! only when the ring is full they go to the overflow queue guarded by its own mutex
+    class ThreadQueue
+    {
+    public:
+        explicit ThreadQueue(const std::thread::id& th);
+
+        const std::thread::id& threadID() const { return m_threadID; }
+
+        void push(const Functor& f);
+        void process();
+
+        ThreadQueue* next = nullptr;
+
+    private:
+        static constexpr size_t CAPACITY = 512;
+
+        struct Slot {
+            std::atomic<size_t> sequence = 0;
+            Functor f;
+        };
+
+        bool tryPush(const Functor& f);
+
+        std::thread::id m_threadID;
+        std::unique_ptr<Slot[]> m_slots;
+        std::atomic<size_t> m_tail = 0;
+        size_t m_head = 0;
+
+        std::mutex m_overflowMutex;
+        std::queue<Functor> m_overflow;
+        std::atomic<size_t> m_overflowSize = 0;
+    };
 
-    using Queue = std::queue<Functor>;
+    ThreadQueue* findQueue(const std::thread::id& th, ThreadQueue* from, ThreadQueue* to = nullptr) const;
+    ThreadQueue* queue(const std::thread::id& th);
 
-    std::recursive_mutex m_mutex;
-    std::map<std::thread::id, Queue > m_queues;
+    std::atomic<ThreadQueue*> m_queues = nullptr;
 
     std::function<void(const std::function<void()>&, bool)> m_onMainThreadInvoke;
     std::thread::id m_mainThreadID;
@@ -283,12 +283,13 @@ void UtfCodec::replaceInvalid(std::string_view src, std::string& dst)
 
 String::String()
 {
-    m_data = std::make_shared<std::u16string>();
 }
 
 String::String(const char16_t* str)
 {
-    m_data = std::make_shared<std::u16string>(str ? str : u"");
+    if (str && *str) {
+        m_data = std::make_shared<std::u16string>(str);
+    }
 #ifdef MUSE_STRING_DEBUG_HACK
     updateDebugView();
 #endif
@@ -305,15 +306,16 @@ String::String(const Char& ch)
 
 String::String(const Char* unicode, size_t size)
 {
-    if (!unicode) {
-        m_data = std::make_shared<std::u16string>();
+    if (!unicode || size == 0) {
         return;
     }
 
     static_assert(sizeof(Char) == sizeof(char16_t));
     const char16_t* str = reinterpret_cast<const char16_t*>(unicode);
     if (size == muse::nidx) {
-        m_data = std::make_shared<std::u16string>(str);
+        if (*str) {
+            m_data = std::make_shared<std::u16string>(str);
+        }
     } else {
         m_data = std::make_shared<std::u16string>(str, size);
     }
@@ -337,6 +339,10 @@ void String::updateDebugView()
 
 const std::u16string& String::constStr() const
 {
+    if (!m_data) {
+        static const std::u16string empty;
+        return empty;
+    }
     return *m_data.get();
 }
 
@@ -376,7 +382,9 @@ struct String::Mutator {
 
 String::Mutator String::mutStr(bool do_detach)
 {
-    if (do_detach) {
+    if (!m_data) {
+        m_data = std::make_shared<std::u16string>();
+    } else if (do_detach) {
         detach();
     }
     return Mutator(*m_data.get(), this);
@@ -724,7 +732,10 @@ bool String::empty() const
 
 void String::clear()
 {
-    mutStr().clear();
+    m_data.reset();
+#ifdef MUSE_STRING_DEBUG_HACK
+    updateDebugView();
+#endif
 }
 
 Char String::at(size_t i) const
@@ -372,6 +372,7 @@ private:
     void detach();
     void doArgs(std::u16string& out, const std::vector<std::u16string_view>& args) const;
 
+    //! NOTE Shared between copies until one is modified, null for an empty string, so empty strings do not allocate
     std::shared_ptr<std::u16string> m_data;
 
 #ifdef MUSE_STRING_DEBUG_HACK
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "instancesregistry.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include "log.h"
+
+using namespace muse::mi;
+using namespace muse::ipc;
+
+InstancesRegistry::InstancesRegistry(const QString& dirPath)
+    : m_dirPath(dirPath)
+{
+}
+
+QString InstancesRegistry::defaultDirPath()
+{
+    //! NOTE Runtime location is per user, unlike the temp location on some systems
+    return QStandardPaths::writableLocation(QStandardPaths::RuntimeLocation) + "/" + SERVER_NAME + "-instances";
+}
+
+QString InstancesRegistry::filePath(const ID& id) const
+{
+    return m_dirPath + "/" + id + ".json";
+}
+
+bool InstancesRegistry::publish(const ID& id, const InstanceState& state)
+{
+    if (!QDir().mkpath(m_dirPath)) {
+        LOGE() << "failed create dir: " << m_dirPath;
+        return false;
+    }
+
+    QJsonObject obj;
+    obj["hasProject"] = state.hasProject;
+    obj["projects"] = QJsonArray::fromStringList(state.projects);
+
+    //! NOTE The file is replaced at once, so readers never see it half written
+    QSaveFile file(filePath(id));
+    if (!file.open(QIODevice::WriteOnly)) {
+        LOGE() << "failed open file: " << file.fileName() << ", err: " << file.errorString();
+        return false;
+    }
+
+    file.write(QJsonDocument(obj).toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        LOGE() << "failed write file: " << file.fileName() << ", err: " << file.errorString();
+        return false;
+    }
+
+    return true;
+}
+
+void InstancesRegistry::unpublish(const ID& id)
+{
+    QFile::remove(filePath(id));
+}
+
+bool InstancesRegistry::read(const ID& id, InstanceState& state) const
+{
+    QFile file(filePath(id));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QJsonParseError err;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &err);
+    if (err.error != QJsonParseError::NoError || !doc.isObject()) {
+        LOGW() << "failed parse state of instance: " << id << ", err: " << err.errorString();
+        return false;
+    }
+
+    QJsonObject obj = doc.object();
+    state.hasProject = obj.value("hasProject").toBool();
+    state.projects.clear();
+    for (const QJsonValue& val : obj.value("projects").toArray()) {
+        state.projects << val.toString();
+    }
+
+    return true;
+}
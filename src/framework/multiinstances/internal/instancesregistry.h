@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MUSE_MI_INSTANCESREGISTRY_H
+#define MUSE_MI_INSTANCESREGISTRY_H
+
+#include <QString>
+#include <QStringList>
+
+#include "ipc/ipc.h"
+
+namespace muse::mi {
+struct InstanceState
+{
+    bool hasProject = false;
+    QStringList projects;
+};
+
+//! NOTE Each instance publishes its state to a file of its own,
+//! so the other instances can read it without a request to that instance.
+//! Files of instances that have quit unexpectedly stay behind,
+//! so only the states of the instances known to be running should be read.
+class InstancesRegistry
+{
+public:
+    InstancesRegistry(const QString& dirPath = defaultDirPath());
+
+    static QString defaultDirPath();
+
+    bool publish(const ipc::ID& id, const InstanceState& state);
+    void unpublish(const ipc::ID& id);
+
+    //! NOTE Returns false if the instance has not published its state
+    bool read(const ipc::ID& id, InstanceState& state) const;
+
+private:
+    QString filePath(const ipc::ID& id) const;
+
+    QString m_dirPath;
+};
+}
+
+#endif // MUSE_MI_INSTANCESREGISTRY_H
@@ -57,6 +57,9 @@ static const QString METHOD_RESOURCE_CHANGED("RESOURCE_CHANGED");
 
 MultiInstancesProvider::~MultiInstancesProvider()
 {
+    if (m_ipcChannel) {
+        m_registry.unpublish(m_ipcChannel->selfID());
+    }
     delete m_ipcChannel;
 }
 
@@ -75,6 +78,49 @@ void MultiInstancesProvider::init()
     m_ipcChannel->instancesChanged().onNotify(this, [this]() { m_instancesChanged.notify(); });
 
     m_ipcChannel->connect();
+
+    if (projectProvider()) {
+        projectProvider()->openedProjectsChanged().onNotify(this, [this]() {
+            publishState();
+        });
+    }
+    publishState();
+}
+
+void MultiInstancesProvider::publishState()
+{
+    if (!projectProvider()) {
+        //! NOTE Without a published state the other instances ask this one
+        return;
+    }
+
+    InstanceState state;
+    state.hasProject = projectProvider()->isAnyProjectOpened();
+    for (const io::path_t& path : projectProvider()->openedProjects()) {
+        state.projects << path.toQString();
+    }
+
+    m_registry.publish(m_ipcChannel->selfID(), state);
+}
+
+bool MultiInstancesProvider::readOtherStates(std::vector<std::pair<ID, InstanceState> >& states) const
+{
+    bool allPublished = true;
+    const ID& selfID = m_ipcChannel->selfID();
+    const QList<ID> ids = m_ipcChannel->instances();
+    for (const ID& id : ids) {
+        if (id == selfID) {
+            continue;
+        }
+
+        InstanceState state;
+        if (m_registry.read(id, state)) {
+            states.emplace_back(id, std::move(state));
+        } else {
+            allPublished = false;
+        }
+    }
+    return allPublished;
 }
 
 bool MultiInstancesProvider::isInited() const
@@ -177,6 +223,18 @@ bool MultiInstancesProvider::isProjectAlreadyOpened(const io::path_t& projectPat
         return false;
     }
 
+    std::vector<std::pair<ID, InstanceState> > states;
+    bool allPublished = readOtherStates(states);
+    for (const auto& st : states) {
+        if (st.second.projects.contains(projectPath.toQString())) {
+            return true;
+        }
+    }
+
+    if (allPublished) {
+        return false;
+    }
+
     int ret = 0;
     m_ipcChannel->syncRequestToAll(METHOD_PROJECT_IS_OPENED, { projectPath.toQString() }, [&ret](const QStringList& args, const ID&) {
         IF_ASSERT_FAILED(!args.empty()) {
@@ -212,6 +270,18 @@ bool MultiInstancesProvider::isHasAppInstanceWithoutProject() const
         return false;
     }
 
+    std::vector<std::pair<ID, InstanceState> > states;
+    bool allPublished = readOtherStates(states);
+    for (const auto& st : states) {
+        if (!st.second.hasProject) {
+            return true;
+        }
+    }
+
+    if (allPublished) {
+        return false;
+    }
+
     bool ret = false;
     m_ipcChannel->syncRequestToAll(METHOD_IS_WITHOUT_PROJECT, {}, [&ret](const QStringList& args, const ID&) {
         IF_ASSERT_FAILED(!args.empty()) {
@@ -238,16 +308,27 @@ void MultiInstancesProvider::activateWindowWithoutProject(const QStringList& arg
 #endif
 
     ID idWithNoProject;
-    m_ipcChannel->syncRequestToAll(METHOD_IS_WITHOUT_PROJECT, {}, [&idWithNoProject](const QStringList& retArgs, const ID& srcId) {
-        IF_ASSERT_FAILED(!retArgs.empty()) {
-            return false;
-        }
-        if (retArgs.at(0).toInt()) {
-            idWithNoProject = srcId;
-            return true;
+    std::vector<std::pair<ID, InstanceState> > states;
+    bool allPublished = readOtherStates(states);
+    for (const auto& st : states) {
+        if (!st.second.hasProject) {
+            idWithNoProject = st.first;
+            break;
         }
-        return false;
-    });
+    }
+
+    if (idWithNoProject.isEmpty() && !allPublished) {
+        m_ipcChannel->syncRequestToAll(METHOD_IS_WITHOUT_PROJECT, {}, [&idWithNoProject](const QStringList& retArgs, const ID& srcId) {
+            IF_ASSERT_FAILED(!retArgs.empty()) {
+                return false;
+            }
+            if (retArgs.at(0).toInt()) {
+                idWithNoProject = srcId;
+                return true;
+            }
+            return false;
+        });
+    }
     if (!idWithNoProject.isEmpty()) {
         m_ipcChannel->response(METHOD_ACTIVATE_WINDOW_WITHOUT_PROJECT, args, idWithNoProject);
         return;
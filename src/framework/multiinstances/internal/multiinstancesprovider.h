@@ -28,6 +28,7 @@
 
 #include "ipc/ipcchannel.h"
 #include "ipc/ipclock.h"
+#include "instancesregistry.h"
 
 #include "modularity/ioc.h"
 #include "actions/iactionsdispatcher.h"
@@ -95,11 +96,19 @@ private:
 
     void onMsg(const muse::ipc::Msg& msg);
 
+    void publishState();
+
+    //! NOTE Reads the published states of the other instances,
+    //! returns false if some of them have not published their state
+    bool readOtherStates(std::vector<std::pair<ipc::ID, InstanceState> >& states) const;
+
     muse::ipc::IpcLock* lock(const std::string& name);
 
     muse::ipc::IpcChannel* m_ipcChannel = nullptr;
     std::string m_selfID;
 
+    InstancesRegistry m_registry;
+
     async::Notification m_instancesChanged;
     async::Channel<std::string> m_resourceChanged;
 
@@ -1,9 +1,12 @@
 #ifndef MUSE_MI_IPROJECTPROVIDER_H
 #define MUSE_MI_IPROJECTPROVIDER_H
 
+#include <vector>
+
 #include "modularity/imoduleinterface.h"
 
 #include "global/io/path.h"
+#include "global/async/notification.h"
 
 namespace muse::mi {
 class IProjectProvider : MODULE_EXPORT_INTERFACE
@@ -16,6 +19,10 @@ public:
 
     virtual bool isProjectOpened(const io::path_t& path) const = 0;
     virtual bool isAnyProjectOpened() const = 0;
+
+    //! NOTE Published to the other instances, see InstancesRegistry
+    virtual std::vector<io::path_t> openedProjects() const = 0;
+    virtual async::Notification openedProjectsChanged() const = 0;
 };
 }
 
@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2025 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <QCoreApplication>
+#include <QProcess>
+#include <QTemporaryDir>
+
+#include "multiinstances/internal/instancesregistry.h"
+
+#include "log.h"
+
+using namespace muse;
+using namespace muse::mi;
+
+static const char* REGISTRY_DIR_ENV = "MUSE_MI_TESTS_REGISTRY_DIR";
+static const char* INSTANCE_ID_ENV = "MUSE_MI_TESTS_INSTANCE_ID";
+
+namespace muse::mi {
+class MultiInstances_InstancesRegistryTests : public ::testing::Test
+{
+};
+}
+
+TEST_F(MultiInstances_InstancesRegistryTests, PublishAndRead)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    InstancesRegistry registry(dir.path());
+
+    InstanceState state;
+    EXPECT_FALSE(registry.read("instance1", state));
+
+    state.hasProject = true;
+    state.projects << "/scores/first.mscz";
+    EXPECT_TRUE(registry.publish("instance1", state));
+
+    InstanceState read;
+    EXPECT_TRUE(InstancesRegistry(dir.path()).read("instance1", read));
+    EXPECT_TRUE(read.hasProject);
+    EXPECT_EQ(read.projects, QStringList { "/scores/first.mscz" });
+
+    // republishing replaces the state
+    state.hasProject = false;
+    state.projects.clear();
+    EXPECT_TRUE(registry.publish("instance1", state));
+    EXPECT_TRUE(registry.read("instance1", read));
+    EXPECT_FALSE(read.hasProject);
+    EXPECT_TRUE(read.projects.isEmpty());
+
+    registry.unpublish("instance1");
+    EXPECT_FALSE(registry.read("instance1", read));
+}
+
+//! NOTE Run in a child process by the test below
+TEST_F(MultiInstances_InstancesRegistryTests, DISABLED_PublishFromOtherProcess)
+{
+    QString dirPath = qEnvironmentVariable(REGISTRY_DIR_ENV);
+    QString id = qEnvironmentVariable(INSTANCE_ID_ENV);
+    ASSERT_FALSE(dirPath.isEmpty());
+    ASSERT_FALSE(id.isEmpty());
+
+    InstanceState state;
+    state.hasProject = true;
+    state.projects << "/scores/" + id + ".mscz";
+    EXPECT_TRUE(InstancesRegistry(dirPath).publish(id, state));
+}
+
+TEST_F(MultiInstances_InstancesRegistryTests, ReadStatesPublishedByOtherProcesses)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    constexpr int INSTANCES = 4;
+    QStringList ids;
+    for (int i = 0; i < INSTANCES; ++i) {
+        QString id = "instance" + QString::number(i);
+        ids << id;
+
+        QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
+        env.insert(REGISTRY_DIR_ENV, dir.path());
+        env.insert(INSTANCE_ID_ENV, id);
+
+        QProcess process;
+        process.setProcessEnvironment(env);
+        process.start(QCoreApplication::applicationFilePath(), {
+            "--gtest_also_run_disabled_tests",
+            "--gtest_filter=MultiInstances_InstancesRegistryTests.DISABLED_PublishFromOtherProcess"
+        });
+        ASSERT_TRUE(process.waitForFinished());
+        ASSERT_EQ(process.exitCode(), 0);
+    }
+
+    InstancesRegistry registry(dir.path());
+
+    auto start = std::chrono::steady_clock::now();
+    for (const QString& id : ids) {
+        InstanceState state;
+        EXPECT_TRUE(registry.read(id, state));
+        EXPECT_TRUE(state.hasProject);
+        EXPECT_EQ(state.projects, QStringList { "/scores/" + id + ".mscz" });
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    LOGI() << "lookup of " << INSTANCES << " instances: " << elapsed << " us";
+
+    // a request to the other instances waits up to this for each of them
+    EXPECT_LT(elapsed, ipc::TIMEOUT_MSEC * 1000);
+}
@@ -2022,10 +2022,14 @@ bool Capella::read(void* p, qint64 len)
     if (len == 0) {
         return true;
     }
-    qint64 rv = f->read((char*)p, len);
-    if (rv != len) {
+    if (len < 0 || curPos + len > qint64(buffer.size())) {
+        if (len > 0) {
+            memset(p, 0, size_t(len));
+        }
+        curPos = buffer.size();
         return false;
     }
+    memcpy(p, buffer.constData() + curPos, size_t(len));
     curPos += len;
     return true;
 }
@@ -2260,8 +2264,7 @@ void Capella::readStaveLayout(CapStaffLayout* sl, int idx)
     default:
     {
         char lines[11];
-        f->read(lines, 11);
-        curPos += 11;
+        read(lines, 11);
     }
     break;
     }
@@ -2295,8 +2298,7 @@ void Capella::readStaveLayout(CapStaffLayout* sl, int idx)
         IF_ASSERT_FAILED(n > 0 && iMin + n <= 128) {
             throw Capella::Error::BAD_FORMAT;
         }
-        f->read(sl->soundMapIn, n);
-        curPos += n;
+        read(sl->soundMapIn, n);
     }
     if (sl->bSoundMapOut) {       // Umleitungstabelle für das Vorspielen
         unsigned char iMin = readByte();
@@ -2304,8 +2306,7 @@ void Capella::readStaveLayout(CapStaffLayout* sl, int idx)
         IF_ASSERT_FAILED(n > 0 && iMin + n <= 128) {
             throw Capella::Error::BAD_FORMAT;
         }
-        f->read(sl->soundMapOut, n);
-        curPos += n;
+        read(sl->soundMapOut, n);
     }
     sl->sound  = readInt();
     sl->volume = readInt();
@@ -2730,9 +2731,10 @@ QPointF Capella::readPoint()
 //   read
 //---------------------------------------------------------
 
-void Capella::read(QFile* fp)
+void Capella::read(QIODevice* fp)
 {
-    f      = fp;
+    // the whole file is read at once, all further reads are served from memory
+    buffer = fp->readAll();
     curPos = 0;
 
     char signature[9];
@@ -23,11 +23,12 @@
 #ifndef __CAPELLA_H__
 #define __CAPELLA_H__
 
+#include <QByteArray>
 #include <QFont>
 
 #include "engraving/types/types.h"
 
-class QFile;
+class QIODevice;
 
 namespace mu::engraving {
 class XmlReader;
@@ -687,7 +688,7 @@ class Capella
     static const char* errmsg[];
     qint64 curPos;
 
-    QFile* f;
+    QByteArray buffer;              // whole file, parsed from curPos
     char* author;
     char* keywords;
     char* comment;
@@ -743,7 +744,7 @@ public:
 
     Capella();
     ~Capella();
-    void read(QFile*);
+    void read(QIODevice*);
     QString error(Error n) const { return QString(errmsg[int(n)]); }
 
     unsigned char readByte();
@@ -22,12 +22,16 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "engraving/engravingerrors.h"
 #include "engraving/dom/masterscore.h"
 
 #include "engraving/tests/utils/scorecomp.h"
 #include "engraving/tests/utils/scorerw.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::engraving;
 
@@ -170,3 +174,32 @@ TEST_F(Capella_Tests, capxTestVolta1) {
 TEST_F(Capella_Tests, capxTestBarline) {
     capxReadTest("testBarline");
 }
+
+//---------------------------------------------------------
+//   capReadBenchmark
+//   import the whole .cap test corpus repeatedly, run with --gtest_also_run_disabled_tests
+//---------------------------------------------------------
+
+TEST_F(Capella_Tests, DISABLED_capReadBenchmark) {
+    const std::vector<String> files = {
+        u"test1", u"test2", u"test3", u"test4", u"test5", u"test6", u"test7", u"test8", u"testTuplet2"
+    };
+    const int ITERATIONS = 50;
+
+    auto importFunc = [](MasterScore* score, const muse::io::path_t& path) -> engraving::Err {
+        return mu::iex::capella::importCapella(score, path.toQString());
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < ITERATIONS; ++i) {
+        for (const String& file : files) {
+            MasterScore* score = ScoreRW::readScore(CAPELLA_DIR + file + u".cap", false, importFunc);
+            EXPECT_TRUE(score);
+            delete score;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    LOGI() << "imported " << ITERATIONS * files.size() << " capella files in " << elapsed.count() << " ms";
+}
@@ -22,8 +22,9 @@
 
 #include "pdfwriter.h"
 
+#include <QCoreApplication>
 #include <QPdfWriter>
-#include <QBuffer>
+#include <QFile>
 
 #include "engraving/dom/masterscore.h"
 
@@ -37,6 +38,42 @@ using namespace muse::io;
 using namespace muse::draw;
 using namespace mu::engraving;
 
+namespace {
+//! NOTE Passes QPdfWriter output to our own device when there is no file to write to.
+//! The output is collected and written in one go on close, because our devices
+//! (ex. muse::io::File) may rewrite their whole content on each write
+class DestinationDeviceAdapter : public QIODevice
+{
+public:
+    DestinationDeviceAdapter(io::IODevice& device)
+        : m_device(device) {}
+
+    bool isSequential() const override { return true; }
+
+    void close() override
+    {
+        if (isOpen() && !m_data.isEmpty()) {
+            m_device.write(reinterpret_cast<const uint8_t*>(m_data.constData()), static_cast<size_t>(m_data.size()));
+            m_data.clear();
+        }
+        QIODevice::close();
+    }
+
+protected:
+    qint64 readData(char*, qint64) override { return -1; }
+
+    qint64 writeData(const char* data, qint64 len) override
+    {
+        m_data.append(data, len);
+        return len;
+    }
+
+private:
+    io::IODevice& m_device;
+    QByteArray m_data;
+};
+}
+
 std::vector<INotationWriter::UnitType> PdfWriter::supportedUnitTypes() const
 {
     return { UnitType::PER_PART, UnitType::MULTI_PART };
@@ -53,11 +90,12 @@ Ret PdfWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
         return make_ret(Ret::Code::UnknownError);
     }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+    std::unique_ptr<QIODevice> outputDevice = openOutputDevice(destinationDevice);
+    if (!outputDevice) {
+        return make_ret(Ret::Code::UnknownError);
+    }
 
-    QPdfWriter pdfWriter(&buf);
+    QPdfWriter pdfWriter(outputDevice.get());
     preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
 
     Painter painter(&pdfWriter, "pdfwriter");
@@ -68,19 +106,22 @@ Ret PdfWriter::write(INotationPtr notation, io::IODevice& destinationDevice, con
     const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
                                                     Val(configuration()->exportPdfWithTransparentBackground())).toBool();
 
+    const int64_t totalPages = pageCount(notation);
+    int64_t currentPage = 0;
+
+    m_isAborted = false;
+    m_progress.start();
+    m_progress.progress(currentPage, totalPages, "");
+
     INotationPainting::Options opt;
     opt.deviceDpi = pdfWriter.logicalDpiX();
-    opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
     opt.printPageBackground = !TRANSPARENT_BACKGROUND;
 
-    notation->painting()->paintPdf(&painter, opt);
+    bool completed = paintPages(notation, painter, pdfWriter, opt, currentPage, totalPages);
 
     painter.endDraw();
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
-
-    return true;
+    return finishWriting(*outputDevice, destinationDevice, completed, totalPages);
 }
 
 Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destinationDevice, const Options& options)
@@ -99,11 +140,12 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
         return make_ret(Ret::Code::UnknownError);
     }
 
-    QByteArray qdata;
-    QBuffer buf(&qdata);
-    buf.open(QIODevice::WriteOnly);
+    std::unique_ptr<QIODevice> outputDevice = openOutputDevice(destinationDevice);
+    if (!outputDevice) {
+        return make_ret(Ret::Code::UnknownError);
+    }
 
-    QPdfWriter pdfWriter(&buf);
+    QPdfWriter pdfWriter(outputDevice.get());
     preparePdfWriter(pdfWriter, firstNotation->projectWorkTitle(), firstNotation->painting()->pageSizeInch().toQSizeF());
 
     Painter painter(&pdfWriter, "pdfwriter");
@@ -114,29 +156,100 @@ Ret PdfWriter::writeList(const INotationPtrList& notations, io::IODevice& destin
     const bool TRANSPARENT_BACKGROUND = muse::value(options, OptionKey::TRANSPARENT_BACKGROUND,
                                                     Val(configuration()->exportPdfWithTransparentBackground())).toBool();
 
-    INotationPainting::Options opt;
-    opt.deviceDpi = pdfWriter.logicalDpiX();
-    opt.onNewPage = [&pdfWriter]() { pdfWriter.newPage(); };
-    opt.printPageBackground = !TRANSPARENT_BACKGROUND;
-
+    int64_t totalPages = 0;
     for (const auto& notation : notations) {
         IF_ASSERT_FAILED(notation) {
             return make_ret(Ret::Code::UnknownError);
         }
 
+        totalPages += pageCount(notation);
+    }
+
+    int64_t currentPage = 0;
+
+    m_isAborted = false;
+    m_progress.start();
+    m_progress.progress(currentPage, totalPages, "");
+
+    INotationPainting::Options opt;
+    opt.deviceDpi = pdfWriter.logicalDpiX();
+    opt.printPageBackground = !TRANSPARENT_BACKGROUND;
+
+    bool completed = true;
+    for (const auto& notation : notations) {
         if (notation != firstNotation) {
             QSizeF size = notation->painting()->pageSizeInch().toQSizeF();
             pdfWriter.setPageSize(QPageSize(size, QPageSize::Inch));
             pdfWriter.newPage();
         }
 
-        notation->painting()->paintPdf(&painter, opt);
+        completed = paintPages(notation, painter, pdfWriter, opt, currentPage, totalPages);
+        if (!completed) {
+            break;
+        }
     }
 
     painter.endDraw();
 
-    ByteArray data = ByteArray::fromQByteArrayNoCopy(qdata);
-    destinationDevice.write(data);
+    return finishWriting(*outputDevice, destinationDevice, completed, totalPages);
+}
+
+muse::Progress* PdfWriter::progress()
+{
+    return &m_progress;
+}
+
+void PdfWriter::abort()
+{
+    m_isAborted = true;
+}
+
+bool PdfWriter::paintPages(const INotationPtr& notation, Painter& painter, QPdfWriter& pdfWriter, INotationPainting::Options opt,
+                           int64_t& currentPage, int64_t totalPages)
+{
+    //! NOTE The pages are painted one by one, so that the progress can be shown
+    //! and a cancel from the progress dialog can be handled between them
+    const int pages = static_cast<int>(pageCount(notation));
+    for (int page = 0; page < pages; ++page) {
+        if (page > 0) {
+            pdfWriter.newPage();
+        }
+
+        opt.fromPage = page;
+        opt.toPage = page;
+        notation->painting()->paintPdf(&painter, opt);
+
+        m_progress.progress(++currentPage, totalPages, "");
+
+        qApp->processEvents();
+        if (m_isAborted) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Ret PdfWriter::finishWriting(QIODevice& outputDevice, io::IODevice& destinationDevice, bool completed, int64_t totalPages)
+{
+    if (!completed) {
+        // the unfinished document is dropped, the caller removes the destination file
+        Ret ret = make_ret(Ret::Code::Cancel);
+        m_progress.finish(ret);
+        return ret;
+    }
+
+    outputDevice.close();
+
+    if (destinationDevice.hasError()) {
+        LOGE() << "Could not write to the destination device";
+        Ret ret = make_ret(Ret::Code::UnknownError);
+        m_progress.finish(ret);
+        return ret;
+    }
+
+    m_progress.progress(totalPages, totalPages, "");
+    m_progress.finish(muse::make_ok());
 
     return true;
 }
@@ -149,3 +262,29 @@ void PdfWriter::preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, co
     pdfWriter.setPageMargins(QMarginsF());
     pdfWriter.setPageLayout(QPageLayout(QPageSize(size, QPageSize::Inch), QPageLayout::Orientation::Portrait, QMarginsF()));
 }
+
+std::unique_ptr<QIODevice> PdfWriter::openOutputDevice(io::IODevice& destinationDevice) const
+{
+    //! NOTE muse::io::File keeps the whole content in memory and rewrites the file on each write,
+    //! so when the destination is a file, the PDF is written to it directly
+    QString path = QString::fromStdString(destinationDevice.meta("file_path"));
+
+    std::unique_ptr<QIODevice> device;
+    if (!path.isEmpty()) {
+        device = std::make_unique<QFile>(path);
+    } else {
+        device = std::make_unique<DestinationDeviceAdapter>(destinationDevice);
+    }
+
+    if (!device->open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        LOGE() << "Could not open output device: " << device->errorString();
+        return nullptr;
+    }
+
+    return device;
+}
+
+int64_t PdfWriter::pageCount(const INotationPtr& notation) const
+{
+    return static_cast<int64_t>(notation->elements()->msScore()->pages().size());
+}
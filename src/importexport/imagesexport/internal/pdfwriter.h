@@ -23,6 +23,8 @@
 #ifndef MU_IMPORTEXPORT_PDFWRITER_H
 #define MU_IMPORTEXPORT_PDFWRITER_H
 
+#include <memory>
+
 #include "abstractimagewriter.h"
 
 #include "../iimagesexportconfiguration.h"
@@ -30,6 +32,7 @@
 #include "global/iapplication.h"
 
 class QPdfWriter;
+class QIODevice;
 
 namespace mu::iex::imagesexport {
 class PdfWriter : public AbstractImageWriter
@@ -46,8 +49,19 @@ public:
     muse::Ret writeList(const notation::INotationPtrList& notations, muse::io::IODevice& dstDevice,
                         const Options& options = Options()) override;
 
+    muse::Progress* progress() override;
+    void abort() override;
+
 private:
     void preparePdfWriter(QPdfWriter& pdfWriter, const QString& title, const QSizeF& size) const;
+    std::unique_ptr<QIODevice> openOutputDevice(muse::io::IODevice& destinationDevice) const;
+    int64_t pageCount(const notation::INotationPtr& notation) const;
+    bool paintPages(const notation::INotationPtr& notation, muse::draw::Painter& painter, QPdfWriter& pdfWriter,
+                    notation::INotationPainting::Options opt, int64_t& currentPage, int64_t totalPages);
+    muse::Ret finishWriting(QIODevice& outputDevice, muse::io::IODevice& destinationDevice, bool completed, int64_t totalPages);
+
+    muse::Progress m_progress;
+    bool m_isAborted = false;
 };
 }
 
@@ -2089,7 +2089,7 @@ static const ChordDescription* harmonyFromXml(Harmony* h, const muse::String& ki
 {
     String lowerCaseKind = kind.toLower();
     const ChordList* cl = h->score()->chordList();
-    for (const auto& p : *cl) {
+    for (const auto& p : cl->descriptions()) {
         const ChordDescription& cd = p.second;
         if (lowerCaseKind == cd.xmlKind) {
             return &cd;
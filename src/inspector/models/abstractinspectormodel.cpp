@@ -20,8 +20,12 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "abstractinspectormodel.h"
+
+#include <optional>
+
 #include "engraving/dom/dynamic.h"
 #include "engraving/dom/property.h"
+#include "engraving/dom/score.h"
 
 #include "shortcuts/shortcutstypes.h"
 
@@ -382,19 +386,28 @@ void AbstractInspectorModel::setPropertyValue(const QList<engraving::EngravingIt
 
     beginCommand(TranslatableString("undoableAction", "Edit %1").arg(propertyUserName(pid)));
 
-    for (mu::engraving::EngravingItem* item : items) {
-        IF_ASSERT_FAILED(item) {
-            continue;
-        }
+    {
+        // the per-element side effects run once, before the layout
+        std::optional<mu::engraving::ScoreChangesBatch> changesBatch;
 
-        mu::engraving::PropertyFlags ps = item->propertyFlags(pid);
+        for (mu::engraving::EngravingItem* item : items) {
+            IF_ASSERT_FAILED(item) {
+                continue;
+            }
 
-        if (ps == mu::engraving::PropertyFlags::STYLED) {
-            ps = mu::engraving::PropertyFlags::UNSTYLED;
-        }
+            if (!changesBatch) {
+                changesBatch.emplace(item->score());
+            }
+
+            mu::engraving::PropertyFlags ps = item->propertyFlags(pid);
 
-        PropertyValue propValue = valueToElementUnits(pid, newValue, item);
-        item->undoChangeProperty(pid, propValue, ps);
+            if (ps == mu::engraving::PropertyFlags::STYLED) {
+                ps = mu::engraving::PropertyFlags::UNSTYLED;
+            }
+
+            PropertyValue propValue = valueToElementUnits(pid, newValue, item);
+            item->undoChangeProperty(pid, propValue, ps);
+        }
     }
 
     updateNotation();
@@ -46,6 +46,8 @@ public:
     virtual muse::SizeF pageSizeInch(const Options& opt) const = 0;
 
     virtual void paintView(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) = 0;
+    //! Paints a single page at the origin, as printed (without selection and other editing state)
+    virtual void paintPage(muse::draw::Painter* painter, int pageIndex) = 0;
     virtual void paintPdf(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(muse::draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(muse::draw::Painter* painter, const Options& opt) = 0;
@@ -638,17 +638,19 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
 
     RectF hitRect(posOnPage.x() - width, posOnPage.y() - width, 3.0 * width, 3.0 * width);
 
-    std::vector<EngravingItem*> potentiallyHitElements = page->items(hitRect);
+    const PageHitTest& pageHits = pageHitTest(page, posOnPage, width, hitRect);
+
+    std::vector<EngravingItem*> headersAndFooters;
 
     for (int i = 0; i < engraving::MAX_HEADERS; ++i) {
         if (score()->headerText(i) != nullptr) { // gives the ability to select the header
-            potentiallyHitElements.push_back(score()->headerText(i));
+            headersAndFooters.push_back(score()->headerText(i));
         }
     }
 
     for (int i = 0; i < engraving::MAX_FOOTERS; ++i) {
         if (score()->footerText(i) != nullptr) { // gives the ability to select the footer
-            potentiallyHitElements.push_back(score()->footerText(i));
+            headersAndFooters.push_back(score()->footerText(i));
         }
     }
 
@@ -666,14 +668,20 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         return true;
     };
 
-    for (EngravingItem* element : potentiallyHitElements) {
+    for (EngravingItem* element : pageHits.candidates) {
         element->itemDiscovered = 0;
+    }
 
-        if (!canHitElement(element)) {
-            continue;
+    for (EngravingItem* element : pageHits.containing) {
+        if (canHitElement(element)) {
+            hitElements.push_back(element);
         }
+    }
+
+    for (EngravingItem* element : headersAndFooters) {
+        element->itemDiscovered = 0;
 
-        if (element->hitShapeContains(posOnPage)) {
+        if (canHitElement(element) && element->hitShapeContains(posOnPage)) {
             hitElements.push_back(element);
         }
     }
@@ -682,12 +690,14 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
         //
         // if no relevant element hit, look nearby
         //
-        for (EngravingItem* element : potentiallyHitElements) {
-            if (!canHitElement(element)) {
-                continue;
+        for (EngravingItem* element : pageHits.intersecting) {
+            if (canHitElement(element)) {
+                hitElements.push_back(element);
             }
+        }
 
-            if (element->hitShapeIntersects(hitRect)) {
+        for (EngravingItem* element : headersAndFooters) {
+            if (canHitElement(element) && element->hitShapeIntersects(hitRect)) {
                 hitElements.push_back(element);
             }
         }
@@ -705,6 +715,39 @@ std::vector<EngravingItem*> NotationInteraction::hitElements(const PointF& pos,
     return hitElements;
 }
 
+const NotationInteraction::PageHitTest& NotationInteraction::pageHitTest(Page* page, const PointF& posOnPage, float width,
+                                                                         const RectF& hitRect) const
+{
+    // Consecutive queries at the same position on an unchanged page (hover, a click followed
+    // by the lookup of overlapping elements, etc.) reuse the previous result
+    PageHitTest& result = m_lastPageHitTest;
+    if (result.page == page && page->isBspTreeValid() && result.pageRevision == page->bspTreeRevision()
+        && result.pos == posOnPage && muse::RealIsEqual(result.width, width)) {
+        return result;
+    }
+
+    result.page = page;
+    result.pos = posOnPage;
+    result.width = width;
+    result.candidates = page->items(hitRect);
+    result.pageRevision = page->bspTreeRevision();
+    result.containing.clear();
+    result.intersecting.clear();
+
+    // the candidates' bounding boxes intersect the hit rect, now test their precise (cached) shapes
+    for (EngravingItem* element : result.candidates) {
+        if (page->hitShapeContains(element, posOnPage)) {
+            result.containing.push_back(element);
+        }
+
+        if (page->hitShapeIntersects(element, hitRect)) {
+            result.intersecting.push_back(element);
+        }
+    }
+
+    return result;
+}
+
 NotationInteraction::HitMeasureData NotationInteraction::hitMeasure(const PointF& pos) const
 {
     mu::engraving::staff_idx_t staffIndex = muse::nidx;
@@ -4574,6 +4617,10 @@ void NotationInteraction::doEndEditElement()
 
 void NotationInteraction::onElementDestroyed(EngravingItem* element)
 {
+    if (m_lastPageHitTest.page) {
+        m_lastPageHitTest = PageHitTest();
+    }
+
     if (m_editData.element == element) {
         m_editData.element = nullptr;
     }
@@ -6070,6 +6117,9 @@ void NotationInteraction::resetShapesAndPosition()
         apply();
     };
 
+    // ends before apply() lays the score out
+    mu::engraving::ScoreChangesBatch changesBatch(score());
+
     if (selection()->element()) {
         resetItem(selection()->element());
         return;
@@ -456,6 +456,19 @@ private:
 
     HitMeasureData hitMeasure(const muse::PointF& pos) const;
 
+    struct PageHitTest
+    {
+        const Page* page = nullptr;
+        size_t pageRevision = 0;
+        muse::PointF pos;
+        float width = 0.0;
+        std::vector<EngravingItem*> candidates;
+        std::vector<EngravingItem*> containing;     // hit shape contains pos
+        std::vector<EngravingItem*> intersecting;   // hit shape intersects the hit rect around pos
+    };
+
+    const PageHitTest& pageHitTest(Page* page, const muse::PointF& posOnPage, float width, const muse::RectF& hitRect) const;
+
     struct DragData
     {
         muse::PointF beginMove;
@@ -531,6 +544,7 @@ private:
 
     bool m_notifyAboutDropChanged = false;
     HitElementContext m_hitElementContext;
+    mutable PageHitTest m_lastPageHitTest;
 
     muse::async::Channel<ShowItemRequest> m_showItemRequested;
 };
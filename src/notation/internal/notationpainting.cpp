@@ -189,6 +189,18 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     doPaint(painter, opt);
 }
 
+void NotationPainting::paintPage(Painter* painter, int pageIndex)
+{
+    Options opt;
+    opt.isSetViewport = false;
+    opt.isMultiPage = false;
+    opt.fromPage = pageIndex;
+    opt.toPage = pageIndex;
+    opt.deviceDpi = uiConfiguration()->logicalDpi();
+    opt.isPrinting = true;
+    doPaint(painter, opt);
+}
+
 void NotationPainting::paintPdf(Painter* painter, const Options& opt)
 {
     Q_ASSERT(opt.deviceDpi > 0);
@@ -242,11 +242,7 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     }
 
     m_notation->notationChanged().onNotify(this, [this]() {
-        if (INotationInteractionPtr interaction = notationInteraction()) {
-            interaction->hideShadowNote();
-        }
-        m_shadowNoteRect = RectF();
-        scheduleRedraw();
+        onNotationChanged();
     });
 
     onNoteInputStateChanged();
@@ -333,6 +329,15 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     emit viewportChanged();
 }
 
+void AbstractNotationPaintView::onNotationChanged()
+{
+    if (INotationInteractionPtr interaction = notationInteraction()) {
+        interaction->hideShadowNote();
+    }
+    m_shadowNoteRect = RectF();
+    scheduleRedraw();
+}
+
 void AbstractNotationPaintView::onUnloadNotation(INotationPtr)
 {
     m_notation->notationChanged().resetOnNotify(this);
@@ -631,7 +636,7 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     painter->setWorldTransform(m_matrix * guiScalingCompensation);
 
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+    paintNotation(painter, toLogical(rect), isPrinting);
 
     const ui::UiContext uiCtx = uiContextResolver()->currentUiContext();
     const bool isOnNotationPage = uiCtx == ui::UiCtxProjectOpened || uiCtx == ui::UiCtxProjectFocused;
@@ -659,6 +664,11 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     }
 }
 
+void AbstractNotationPaintView::paintNotation(muse::draw::Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    notation()->painting()->paintView(painter, frameRect, isPrinting);
+}
+
 void AbstractNotationPaintView::onNotationSetup()
 {
     TRACEFUNC;
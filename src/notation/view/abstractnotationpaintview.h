@@ -183,11 +183,13 @@ protected:
 
     // Draw
     void paint(QPainter* painter) override;
+    virtual void paintNotation(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting);
 
     virtual void onNotationSetup();
 
     virtual void onLoadNotation(INotationPtr notation);
     virtual void onUnloadNotation(INotationPtr notation);
+    virtual void onNotationChanged();
 
     virtual void initZoomAndPosition();
 
@@ -21,6 +21,10 @@
  */
 #include "notationnavigator.h"
 
+#include <cmath>
+
+#include <QQuickWindow>
+
 #include "log.h"
 
 using namespace muse;
@@ -62,10 +66,16 @@ void NotationNavigator::load()
     initVisible();
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        clearPageThumbnails();
         update();
         m_cursorRectView->update();
     });
 
+    configuration()->foregroundChanged().onNotify(this, [this]() {
+        clearPageThumbnails();
+        update();
+    });
+
     AbstractNotationPaintView::load();
 }
 
@@ -268,10 +278,86 @@ void NotationNavigator::paint(QPainter* painter)
     paintPageNumbers(painter);
 }
 
+void NotationNavigator::paintNotation(draw::Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    if (notationViewMode() != ViewMode::PAGE || !isPrinting) {
+        AbstractNotationPaintView::paintNotation(painter, frameRect, isPrinting);
+        return;
+    }
+
+    TRACEFUNC;
+
+    const draw::Transform transform = painter->worldTransform();
+    const qreal scaling = transform.m11();
+    if (!qFuzzyCompare(scaling, m_pageThumbnailsScaling)) {
+        clearPageThumbnails();
+        m_pageThumbnailsScaling = scaling;
+    }
+
+    //! NOTE Thumbnails are already scaled, draw them in device coordinates
+    painter->save();
+    painter->setWorldTransform(draw::Transform());
+
+    for (const Page* page : pages()) {
+        const RectF pageRect = page->ldata()->bbox().translated(page->pos());
+        if (!pageRect.intersects(frameRect)) {
+            continue;
+        }
+
+        painter->drawPixmap(transform.map(pageRect.topLeft()), pageThumbnail(page, scaling));
+    }
+
+    painter->restore();
+}
+
+const QPixmap& NotationNavigator::pageThumbnail(const Page* page, qreal scaling)
+{
+    auto it = m_pageThumbnails.find(page);
+    if (it != m_pageThumbnails.end()) {
+        return it->second;
+    }
+
+    TRACEFUNC;
+
+    const RectF pageRect = page->ldata()->bbox();
+    const qreal pixelRatio = window() ? window()->devicePixelRatio() : 1.0;
+
+    QPixmap thumbnail(std::ceil(pageRect.width() * scaling * pixelRatio), std::ceil(pageRect.height() * scaling * pixelRatio));
+    thumbnail.setDevicePixelRatio(pixelRatio);
+    thumbnail.fill(Qt::transparent);
+
+    {
+        QPainter qp(&thumbnail);
+        draw::Painter painter(&qp, "navigator_page_thumbnail");
+        painter.scale(scaling, scaling);
+        painter.translate(-pageRect.topLeft());
+        notation()->painting()->paintPage(&painter, static_cast<int>(page->no()));
+    }
+
+    return m_pageThumbnails.emplace(page, std::move(thumbnail)).first->second;
+}
+
+void NotationNavigator::clearPageThumbnails()
+{
+    m_pageThumbnails.clear();
+}
+
 void NotationNavigator::onViewSizeChanged()
 {
 }
 
+void NotationNavigator::onNotationChanged()
+{
+    clearPageThumbnails();
+    AbstractNotationPaintView::onNotationChanged();
+}
+
+void NotationNavigator::onUnloadNotation(INotationPtr notation)
+{
+    clearPageThumbnails();
+    AbstractNotationPaintView::onUnloadNotation(notation);
+}
+
 void NotationNavigator::paintPageNumbers(QPainter* painter)
 {
     if (notationViewMode() != ViewMode::PAGE) {
@@ -22,9 +22,12 @@
 #ifndef MU_NOTATION_NOTATIONNAVIGATOR_H
 #define MU_NOTATION_NOTATIONNAVIGATOR_H
 
+#include <unordered_map>
+
 #include <QObject>
 #include <QMouseEvent>
 #include <QPainter>
+#include <QPixmap>
 #include <QQuickPaintedItem>
 
 #include "draw/types/geometry.h"
@@ -87,13 +90,18 @@ private:
     void rescale();
 
     void paint(QPainter* painter) override;
+    void paintNotation(muse::draw::Painter* painter, const muse::RectF& frameRect, bool isPrinting) override;
     void onViewSizeChanged() override;
+    void onNotationChanged() override;
+    void onUnloadNotation(INotationPtr notation) override;
 
     void wheelEvent(QWheelEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
     void mouseMoveEvent(QMouseEvent* event) override;
 
     void paintPageNumbers(QPainter* painter);
+    const QPixmap& pageThumbnail(const Page* page, qreal scaling);
+    void clearPageThumbnails();
 
     bool moveCanvasToRect(const muse::RectF& viewRect);
 
@@ -104,6 +112,11 @@ private:
     muse::RectF m_cursorRect;
     NotationNavigatorCursorView* m_cursorRectView = nullptr;
     muse::PointF m_startMove;
+
+    //! NOTE Pages rendered at the navigator scale, so that moving the cursor
+    //! rect doesn't repaint the whole score. Cleared on every relayout
+    std::unordered_map<const Page*, QPixmap> m_pageThumbnails;
+    qreal m_pageThumbnailsScaling = 0.0;
 };
 }
 
@@ -69,11 +69,6 @@ MixerChannelItem::MixerChannelItem(QObject* parent, Type type, bool outputOnly,
     });
 }
 
-MixerChannelItem::~MixerChannelItem()
-{
-    m_audioSignalChanges.resetOnReceive(this);
-}
-
 MixerChannelItem::Type MixerChannelItem::type() const
 {
     return m_type;
@@ -364,31 +359,43 @@ void MixerChannelItem::loadSoloMuteState(const notation::INotationSoloMuteState:
     }
 }
 
-void MixerChannelItem::subscribeOnAudioSignalChanges(AudioSignalChanges&& audioSignalChanges)
+void MixerChannelItem::setAudioSignals(AudioSignalsSnapshotPtr audioSignals)
 {
-    m_audioSignalChanges = audioSignalChanges;
+    m_audioSignals = std::move(audioSignals);
+    m_audioSignalsRevision = 0;
+}
 
-    m_audioSignalChanges.onReceive(this, [this](const AudioSignalValuesMap& signalValues) {
-        //!Note There should be no signal changes when the mixer channel is muted.
-        //!     But some audio signal changes still might be "on the way" from the times when the mixer channel wasn't muted
-        //!     So that we have to just ignore them
-        if (muted()) {
-            return;
-        }
+void MixerChannelItem::updateAudioSignals()
+{
+    if (!m_audioSignals) {
+        return;
+    }
+
+    uint64_t revision = m_audioSignals->revision();
+    if (revision == m_audioSignalsRevision) {
+        return;
+    }
 
-        for (const auto& pair : signalValues) {
-            audioch_t audioChNum = pair.first;
-            volume_dbfs_t newPressure = pair.second.pressure;
+    m_audioSignalsRevision = revision;
 
-            if (newPressure < MIN_DISPLAYED_DBFS) {
-                setAudioChannelVolumePressure(audioChNum, MIN_DISPLAYED_DBFS);
-            } else if (newPressure > MAX_DISPLAYED_DBFS) {
-                setAudioChannelVolumePressure(audioChNum, MAX_DISPLAYED_DBFS);
-            } else {
-                setAudioChannelVolumePressure(audioChNum, newPressure);
-            }
+    //!Note There should be no signal changes when the mixer channel is muted.
+    //!     But the last values from the times when the mixer channel wasn't muted might still be in the snapshot
+    //!     So that we have to just ignore them
+    if (muted()) {
+        return;
+    }
+
+    for (audioch_t audioChNum = 0; audioChNum < m_audioSignals->channelsCount(); ++audioChNum) {
+        volume_dbfs_t newPressure = m_audioSignals->signalValue(audioChNum).pressure;
+
+        if (newPressure < MIN_DISPLAYED_DBFS) {
+            setAudioChannelVolumePressure(audioChNum, MIN_DISPLAYED_DBFS);
+        } else if (newPressure > MAX_DISPLAYED_DBFS) {
+            setAudioChannelVolumePressure(audioChNum, MAX_DISPLAYED_DBFS);
+        } else {
+            setAudioChannelVolumePressure(audioChNum, newPressure);
         }
-    });
+    }
 }
 
 void MixerChannelItem::setTitle(QString title)
@@ -84,8 +84,6 @@ public:
     MixerChannelItem() = default;
     MixerChannelItem(QObject* parent, Type type, bool outputOnly = false, muse::audio::TrackId trackId = -1);
 
-    ~MixerChannelItem() override;
-
     Type type() const;
 
     muse::audio::TrackId trackId() const;
@@ -114,7 +112,8 @@ public:
     void loadOutputParams(const muse::audio::AudioOutputParams& newParams);
     void loadSoloMuteState(const notation::INotationSoloMuteState::SoloMuteState& newState);
 
-    void subscribeOnAudioSignalChanges(muse::audio::AudioSignalChanges&& audioSignalChanges);
+    void setAudioSignals(muse::audio::AudioSignalsSnapshotPtr audioSignals);
+    void updateAudioSignals();
 
     bool outputOnly() const;
 
@@ -197,7 +196,8 @@ protected:
     QMap<muse::audio::AudioFxChainOrder, OutputResourceItem*> m_outputResourceItems;
     QMap<muse::audio::aux_channel_idx_t, AuxSendItem*> m_auxSendItems;
 
-    muse::audio::AudioSignalChanges m_audioSignalChanges;
+    muse::audio::AudioSignalsSnapshotPtr m_audioSignals;
+    uint64_t m_audioSignalsRevision = 0;
 
     QString m_title;
     bool m_outputOnly = false;
@@ -41,6 +41,15 @@ MixerPanelModel::MixerPanelModel(QObject* parent)
     controller()->currentTrackSequenceIdChanged().onNotify(this, [this]() {
         load();
     });
+
+    //! NOTE The audio thread only publishes the latest levels, the meters pick them up at display rate
+    m_audioSignalsTimer.setInterval(32); // 30 fps
+    connect(&m_audioSignalsTimer, &QTimer::timeout, this, [this]() {
+        for (MixerChannelItem* item : m_mixerChannelList) {
+            item->updateAudioSignals();
+        }
+    });
+    m_audioSignalsTimer.start();
 }
 
 void MixerPanelModel::load()
@@ -443,14 +452,14 @@ MixerChannelItem* MixerPanelModel::buildInstrumentChannelItem(const TrackId trac
                << ", " << text;
     });
 
-    playback()->audioOutput()->signalChanges(m_currentTrackSequenceId, trackId)
-    .onResolve(this, [this, trackId](AudioSignalChanges signalChanges) {
+    playback()->audioOutput()->signalValues(m_currentTrackSequenceId, trackId)
+    .onResolve(this, [this, trackId](AudioSignalsSnapshotPtr audioSignals) {
         if (MixerChannelItem* item = findChannelItem(trackId)) {
-            item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+            item->setAudioSignals(std::move(audioSignals));
         }
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from mixer channel, error code: " << errCode
+        LOGE() << "unable to get audio signal values of mixer channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -505,14 +514,14 @@ MixerChannelItem* MixerPanelModel::buildAuxChannelItem(aux_channel_idx_t index,
                << ", " << text;
     });
 
-    playback()->audioOutput()->signalChanges(m_currentTrackSequenceId, trackId)
-    .onResolve(this, [this, trackId](AudioSignalChanges signalChanges) {
+    playback()->audioOutput()->signalValues(m_currentTrackSequenceId, trackId)
+    .onResolve(this, [this, trackId](AudioSignalsSnapshotPtr audioSignals) {
         if (MixerChannelItem* item = findChannelItem(trackId)) {
-            item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+            item->setAudioSignals(std::move(audioSignals));
         }
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from mixer channel, error code: " << errCode
+        LOGE() << "unable to get audio signal values of mixer channel, error code: " << errCode
                << ", " << text;
     });
 
@@ -545,14 +554,14 @@ MixerChannelItem* MixerPanelModel::buildMasterChannelItem()
                << ", " << text;
     });
 
-    playback()->audioOutput()->masterSignalChanges()
-    .onResolve(this, [this, item](AudioSignalChanges signalChanges) {
+    playback()->audioOutput()->masterSignalValues()
+    .onResolve(this, [this, item](AudioSignalsSnapshotPtr audioSignals) {
         if (m_masterChannelItem && item == m_masterChannelItem) {
-            item->subscribeOnAudioSignalChanges(std::move(signalChanges));
+            item->setAudioSignals(std::move(audioSignals));
         }
     })
     .onReject(this, [](int errCode, std::string text) {
-        LOGE() << "unable to subscribe on audio signal changes from master channel, error code: " << errCode
+        LOGE() << "unable to get audio signal values of master channel, error code: " << errCode
                << ", " << text;
     });
 
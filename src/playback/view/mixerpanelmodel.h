@@ -25,6 +25,7 @@
 
 #include <QAbstractListModel>
 #include <QList>
+#include <QTimer>
 
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -111,6 +112,8 @@ private:
     MixerChannelItem* m_masterChannelItem = nullptr;
     muse::audio::TrackSequenceId m_currentTrackSequenceId = -1;
 
+    QTimer m_audioSignalsTimer;
+
     muse::ui::NavigationSection* m_navigationSection = nullptr;
     int m_navigationOrderStart = 1;
 };
@@ -97,6 +97,15 @@ void ProjectActionsController::init()
     dispatcher()->reg(this, "continue-last-session", this, &ProjectActionsController::continueLastSession);
 
     dispatcher()->reg(this, "project-properties", this, &ProjectActionsController::openProjectProperties);
+
+    globalContext()->currentProjectChanged().onNotify(this, [this]() {
+        if (INotationProjectPtr project = currentNotationProject()) {
+            project->pathChanged().onNotify(this, [this]() {
+                m_openedProjectsChanged.notify();
+            });
+        }
+        m_openedProjectsChanged.notify();
+    });
 }
 
 INotationProjectPtr ProjectActionsController::currentNotationProject() const
@@ -642,6 +651,20 @@ bool ProjectActionsController::isAnyProjectOpened() const
     return false;
 }
 
+std::vector<muse::io::path_t> ProjectActionsController::openedProjects() const
+{
+    auto project = globalContext()->currentProject();
+    if (!project || project->path().empty()) {
+        return {};
+    }
+    return { project->path() };
+}
+
+muse::async::Notification ProjectActionsController::openedProjectsChanged() const
+{
+    return m_openedProjectsChanged;
+}
+
 void ProjectActionsController::newProject()
 {
     //! NOTE This method is synchronous,
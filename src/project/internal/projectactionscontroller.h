@@ -100,6 +100,8 @@ public:
     // mi::IProjectProvider
     bool isProjectOpened(const muse::io::path_t& scorePath) const override;
     bool isAnyProjectOpened() const override;
+    std::vector<muse::io::path_t> openedProjects() const override;
+    muse::async::Notification openedProjectsChanged() const override;
 
     const ProjectBeingDownloaded& projectBeingDownloaded() const override;
     muse::async::Notification projectBeingDownloadedChanged() const override;
@@ -232,6 +234,8 @@ private:
 
     ProjectBeingDownloaded m_projectBeingDownloaded;
     muse::async::Notification m_projectBeingDownloadedChanged;
+
+    muse::async::Notification m_openedProjectsChanged;
 };
 }
 